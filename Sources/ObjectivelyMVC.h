@@ -36,7 +36,9 @@
 #include <ObjectivelyMVC/CollectionView.h>
 #include <ObjectivelyMVC/Colors.h>
 #include <ObjectivelyMVC/Constraint.h>
+#include <ObjectivelyMVC/ConstraintSolver.h>
 #include <ObjectivelyMVC/Control.h>
+#include <ObjectivelyMVC/CoreRenderer.h>
 #include <ObjectivelyMVC/Font.h>
 #include <ObjectivelyMVC/HSVColorPicker.h>
 #include <ObjectivelyMVC/HueColorPicker.h>
@@ -52,10 +54,12 @@
 #include <ObjectivelyMVC/Panel.h>
 #include <ObjectivelyMVC/ProgressBar.h>
 #include <ObjectivelyMVC/Renderer.h>
+#include <ObjectivelyMVC/RendererStatsView.h>
 #include <ObjectivelyMVC/RGBColorPicker.h>
 #include <ObjectivelyMVC/ScrollView.h>
 #include <ObjectivelyMVC/Select.h>
 #include <ObjectivelyMVC/Slider.h>
+#include <ObjectivelyMVC/SoftwareRenderer.h>
 #include <ObjectivelyMVC/StackView.h>
 #include <ObjectivelyMVC/TableCellView.h>
 #include <ObjectivelyMVC/TableColumn.h>
@@ -68,8 +72,10 @@
 #include <ObjectivelyMVC/TabViewItem.h>
 #include <ObjectivelyMVC/Text.h>
 #include <ObjectivelyMVC/TextView.h>
+#include <ObjectivelyMVC/Trace.h>
 #include <ObjectivelyMVC/Types.h>
 #include <ObjectivelyMVC/View.h>
+#include <ObjectivelyMVC/View+Binary.h>
 #include <ObjectivelyMVC/View+JSON.h>
 #include <ObjectivelyMVC/ViewController.h>
 #include <ObjectivelyMVC/Window.h>
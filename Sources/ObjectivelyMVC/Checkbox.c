@@ -163,6 +163,8 @@ static void stateDidChange(Control *self) {
 	} else {
 		this->check->view.hidden = true;
 	}
+
+	$((View *) this->check, setNeedsLayout);
 }
 
 #pragma mark - Checkbox
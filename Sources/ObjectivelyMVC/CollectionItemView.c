@@ -89,6 +89,8 @@ static void setSelected(CollectionItemView *self, _Bool selected) {
 	} else {
 		self->view.borderWidth = 0;
 	}
+
+	$((View *) self, setNeedsDisplay);
 }
 
 #pragma mark - Class lifecycle
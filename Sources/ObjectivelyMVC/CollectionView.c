@@ -43,7 +43,9 @@ static void dealloc(Object *self) {
 
 	release(this->contentView);
 	release(this->items);
+	release(this->reusableItems);
 	release(this->scrollView);
+	release(this->selectedItems);
 
 	super(Object, self, dealloc);
 }
@@ -62,7 +64,8 @@ static void awakeWithDictionary(View *self, const Dictionary *dictionary) {
 	const Inlet inlets[] = MakeInlets(
 		MakeInlet("axis", InletTypeEnum, &this->axis, (ident) CollectionViewAxisNames),
 		MakeInlet("itemSize", InletTypeSize, &this->itemSize, NULL),
-		MakeInlet("itemSpacing", InletTypeSize, &this->itemSpacing, NULL)
+		MakeInlet("itemSpacing", InletTypeSize, &this->itemSpacing, NULL),
+		MakeInlet("virtualized", InletTypeBool, &this->virtualized, NULL)
 	);
 
 	$(self, bind, inlets, dictionary);
@@ -75,6 +78,159 @@ static View *init(View *self) {
 	return (View *) $((CollectionView *) self, initWithFrame, NULL, ControlStyleDefault);
 }
 
+/**
+ * @return The number of items laid out along the primary axis before wrapping.
+ */
+static size_t itemsPerLine(const CollectionView *self, const SDL_Rect *bounds) {
+
+	int available, size, stride;
+	switch (self->axis) {
+		case CollectionViewAxisVertical:
+			available = bounds->w - bounds->x;
+			size = self->itemSize.w;
+			stride = self->itemSize.w + self->itemSpacing.w;
+			break;
+		case CollectionViewAxisHorizontal:
+			available = bounds->h - bounds->y;
+			size = self->itemSize.h;
+			stride = self->itemSize.h + self->itemSpacing.h;
+			break;
+	}
+
+	if (available > size && stride > 0) {
+		return (available - size) / stride + 1;
+	}
+
+	return 1;
+}
+
+/**
+ * @return The origin of the item at the given index, in the content View's coordinate space.
+ */
+static SDL_Point originForItemAtIndex(const CollectionView *self, const SDL_Rect *bounds, size_t itemsPerLine, size_t index) {
+
+	const int line = (int) (index / itemsPerLine);
+	const int position = (int) (index % itemsPerLine);
+
+	const int itemWidth = self->itemSize.w + self->itemSpacing.w;
+	const int itemHeight = self->itemSize.h + self->itemSpacing.h;
+
+	switch (self->axis) {
+		case CollectionViewAxisVertical:
+			return MakePoint(bounds->x + position * itemWidth, bounds->y + line * itemHeight);
+		case CollectionViewAxisHorizontal:
+			return MakePoint(bounds->x + line * itemWidth, bounds->y + position * itemHeight);
+	}
+
+	return MakePoint(bounds->x, bounds->y);
+}
+
+/**
+ * @brief Materializes the items intersecting the visible area of the ScrollView, recycling those
+ * which have scrolled out of view, and sizes the content View to contain all items.
+ */
+static void layoutSubviews_virtualize(CollectionView *self, const SDL_Rect *bounds, size_t itemsPerLine) {
+
+	View *contentView = self->contentView;
+
+	const int itemWidth = self->itemSize.w + self->itemSpacing.w;
+	const int itemHeight = self->itemSize.h + self->itemSpacing.h;
+
+	int offset, extent, stride;
+	switch (self->axis) {
+		case CollectionViewAxisVertical:
+			offset = -self->scrollView->contentOffset.y - contentView->padding.top - bounds->y;
+			extent = bounds->h;
+			stride = max(itemHeight, 1);
+			break;
+		case CollectionViewAxisHorizontal:
+			offset = -self->scrollView->contentOffset.x - contentView->padding.left - bounds->x;
+			extent = bounds->w;
+			stride = max(itemWidth, 1);
+			break;
+	}
+
+	const ssize_t firstLine = offset / stride - COLLECTION_VIEW_VIRTUAL_OVERSCAN;
+	const ssize_t lastLine = (offset + extent) / stride + 1 + COLLECTION_VIEW_VIRTUAL_OVERSCAN;
+
+	const ssize_t first = clamp(firstLine * (ssize_t) itemsPerLine, 0, (ssize_t) self->numberOfItems);
+	const ssize_t last = clamp(lastLine * (ssize_t) itemsPerLine, first, (ssize_t) self->numberOfItems);
+
+	const Array *items = (Array *) self->items;
+
+	if (first != (ssize_t) self->firstItem || last - first != (ssize_t) items->count) {
+
+		MutableArray *visibleItems = $$(MutableArray, arrayWithCapacity, last - first);
+
+		const size_t capacity = (lastLine - firstLine) * itemsPerLine;
+
+		for (size_t i = 0; i < items->count; i++) {
+
+			CollectionItemView *item = $(items, objectAtIndex, i);
+
+			const ssize_t index = (ssize_t) (self->firstItem + i);
+			if (index < first || index >= last) {
+				$((View *) item, removeFromSuperview);
+
+				if (((Array *) self->reusableItems)->count < capacity) {
+					$(self->reusableItems, addObject, item);
+				}
+			}
+		}
+
+		for (ssize_t index = first; index < last; index++) {
+
+			CollectionItemView *item;
+			if (index >= (ssize_t) self->firstItem && index < (ssize_t) (self->firstItem + items->count)) {
+				item = retain($(items, objectAtIndex, index - self->firstItem));
+			} else {
+				IndexPath *indexPath = $(alloc(IndexPath), initWithIndex, index);
+
+				item = self->delegate.itemForObjectAtIndexPath(self, indexPath);
+				assert(item);
+
+				release(indexPath);
+
+				$(contentView, addSubview, (View *) item);
+			}
+
+			const _Bool isSelected = $((IndexSet *) self->selectedItems, containsIndex, index);
+			$(item, setSelected, isSelected);
+
+			$(visibleItems, addObject, item);
+			release(item);
+		}
+
+		release(self->items);
+		self->items = visibleItems;
+
+		self->firstItem = first;
+	}
+
+	SDL_Size size = MakeSize(0, 0);
+
+	if (self->numberOfItems) {
+		const int lines = (int) ((self->numberOfItems + itemsPerLine - 1) / itemsPerLine);
+		const int positions = (int) min(self->numberOfItems, itemsPerLine);
+
+		switch (self->axis) {
+			case CollectionViewAxisVertical:
+				size.w = bounds->x + (positions - 1) * itemWidth + self->itemSize.w;
+				size.h = bounds->y + (lines - 1) * itemHeight + self->itemSize.h;
+				break;
+			case CollectionViewAxisHorizontal:
+				size.w = bounds->x + (lines - 1) * itemWidth + self->itemSize.w;
+				size.h = bounds->y + (positions - 1) * itemHeight + self->itemSize.h;
+				break;
+		}
+	}
+
+	size.w += contentView->padding.left + contentView->padding.right;
+	size.h += contentView->padding.top + contentView->padding.bottom;
+
+	$(contentView, resize, &size);
+}
+
 /**
  * @see View::layoutSubviews(View *)
  */
@@ -86,34 +242,23 @@ static void layoutSubviews(View *self) {
 
 	const SDL_Rect bounds = $((View *) this->scrollView, bounds);
 
-	int x = bounds.x, y = bounds.y;
+	const size_t perLine = itemsPerLine(this, &bounds);
+
+	if (this->virtualized) {
+		layoutSubviews_virtualize(this, &bounds, perLine);
+	}
 
 	const Array *items = (Array *) this->items;
 	for (size_t i = 0; i < items->count; i++) {
 
 		CollectionItemView *item = (CollectionItemView *) $(items, objectAtIndex, i);
 
-		item->view.frame.x = x;
-		item->view.frame.y = y;
+		const SDL_Point origin = originForItemAtIndex(this, &bounds, perLine, this->firstItem + i);
+
+		item->view.frame.x = origin.x;
+		item->view.frame.y = origin.y;
 		item->view.frame.w = this->itemSize.w;
 		item->view.frame.h = this->itemSize.h;
-
-		switch (this->axis) {
-			case CollectionViewAxisVertical:
-				x += this->itemSize.w + this->itemSpacing.w;
-				if (x + this->itemSize.w > bounds.w) {
-					y += this->itemSize.h + this->itemSpacing.h;
-					x = bounds.x;
-				}
-				break;
-			case CollectionViewAxisHorizontal:
-				y += this->itemSize.h + this->itemSpacing.h;
-				if (y + this->itemSize.h > bounds.h) {
-					x += this->itemSize.w + this->itemSpacing.w;
-					y = bounds.y;
-				}
-				break;
-		}
 	}
 }
 
@@ -182,8 +327,39 @@ static _Bool captureEvent(Control *self, const SDL_Event *event) {
 	return super(Control, self, captureEvent, event);
 }
 
+#pragma mark - ScrollViewDelegate
+
+/**
+ * @see ScrollViewDelegate::didScroll(ScrollView *)
+ */
+static void didScroll(ScrollView *scrollView) {
+
+	CollectionView *this = (CollectionView *) scrollView->delegate.self;
+	if (this->virtualized) {
+		$((View *) this, setNeedsLayout);
+	}
+}
+
 #pragma mark - CollectionView
 
+/**
+ * @fn CollectionItemView *CollectionView::dequeueReusableItem(CollectionView *self)
+ * @memberof CollectionView
+ */
+static CollectionItemView *dequeueReusableItem(CollectionView *self) {
+
+	const Array *reusableItems = (Array *) self->reusableItems;
+	if (reusableItems->count) {
+
+		CollectionItemView *item = retain($(reusableItems, lastObject));
+		$(self->reusableItems, removeLastObject);
+
+		return item;
+	}
+
+	return NULL;
+}
+
 /**
  * @brief ArrayEnumerator for all item deselection.
  */
@@ -196,6 +372,9 @@ static void deselectAll_enumerate(const Array *array, ident obj, ident data) {
  * @memberof CollectionView
  */
 static void deselectAll(CollectionView *self) {
+
+	$(self->selectedItems, removeAllIndexes);
+
 	$((Array *) self->items, enumerateObjects, deselectAll_enumerate, NULL);
 }
 
@@ -206,6 +385,11 @@ static void deselectAll(CollectionView *self) {
 static void deselectItemAtIndexPath(CollectionView *self, const IndexPath *indexPath) {
 
 	if (indexPath) {
+		const size_t index = $(indexPath, indexAtPosition, 0);
+		if (index < self->numberOfItems) {
+			$(self->selectedItems, removeIndex, index);
+		}
+
 		CollectionItemView *item = $(self, itemAtIndexPath, indexPath);
 		if (item) {
 			$(item, setSelected, false);
@@ -217,7 +401,7 @@ static void deselectItemAtIndexPath(CollectionView *self, const IndexPath *index
  * @brief ArrayEnumerator for item deselection.
  */
 static void deselectItemsAtIndexPaths_enumerate(const Array *array, ident obj, ident data) {
-	$((CollectionItemView *) obj, setSelected, false);
+	$((CollectionView *) data, deselectItemAtIndexPath, (IndexPath *) obj);
 }
 
 /**
@@ -263,7 +447,7 @@ static IndexPath *indexPathForItemAtPoint(const CollectionView *self, const SDL_
 				break;
 		}
 
-		if (index < self->items->array.count) {
+		if (index < self->numberOfItems) {
 			return $(alloc(IndexPath), initWithIndex, index);
 		}
 	}
@@ -279,7 +463,7 @@ static IndexPath *indexPathForItem(const CollectionView *self, const CollectionI
 
 	const ssize_t index = $((Array *) self->items, indexOfObject, (ident) item);
 	if (index > -1) {
-		return $(alloc(IndexPath), initWithIndex, index);
+		return $(alloc(IndexPath), initWithIndex, self->firstItem + index);
 	}
 
 	return NULL;
@@ -295,6 +479,13 @@ static CollectionView *initWithFrame(CollectionView *self, const SDL_Rect *frame
 	if (self) {
 
 		self->items = $$(MutableArray, array);
+		assert(self->items);
+
+		self->reusableItems = $$(MutableArray, array);
+		assert(self->reusableItems);
+
+		self->selectedItems = $(alloc(MutableIndexSet), init);
+		assert(self->selectedItems);
 
 		self->contentView = $(alloc(View), initWithFrame, NULL);
 		assert(self->contentView);
@@ -306,6 +497,9 @@ static CollectionView *initWithFrame(CollectionView *self, const SDL_Rect *frame
 
 		self->scrollView->control.view.autoresizingMask = ViewAutoresizingFill;
 
+		self->scrollView->delegate.self = self;
+		self->scrollView->delegate.didScroll = didScroll;
+
 		$(self->scrollView, setContentView, self->contentView);
 
 		$((View *) self, addSubview, (View *) self->scrollView);
@@ -346,8 +540,8 @@ static CollectionItemView *itemAtIndexPath(const CollectionView *self, const Ind
 		const Array *items = (Array *) self->items;
 		const size_t index = $(indexPath, indexAtPosition, 0);
 
-		if (index < items->count) {
-			return $(items, objectAtIndex, index);
+		if (index >= self->firstItem && index < self->firstItem + items->count) {
+			return $(items, objectAtIndex, index - self->firstItem);
 		}
 	}
 
@@ -371,24 +565,38 @@ static void reloadData(CollectionView *self) {
 	assert(self->delegate.itemForObjectAtIndexPath);
 
 	$((Array *) self->items, enumerateObjects, reloadData_removeItems, self->contentView);
+
+	$(self->reusableItems, removeAllObjects);
+
+	if (self->virtualized) {
+		$(self->reusableItems, addObjectsFromArray, (Array *) self->items);
+	}
+
 	$(self->items, removeAllObjects);
 
-	const size_t numberOfItems = self->dataSource.numberOfItems(self);
-	for (size_t i = 0; i < numberOfItems; i++) {
+	$(self->selectedItems, removeAllIndexes);
 
-		IndexPath *indexPath = $(alloc(IndexPath), initWithIndex, i);
+	self->firstItem = 0;
 
-		CollectionItemView *item = self->delegate.itemForObjectAtIndexPath(self, indexPath);
-		assert(item);
+	self->numberOfItems = self->dataSource.numberOfItems(self);
 
-		$(self->items, addObject, item);
-		$(self->contentView, addSubview, (View *) item);
+	if (self->virtualized == false) {
+		for (size_t i = 0; i < self->numberOfItems; i++) {
 
-		release(item);
-		release(indexPath);
+			IndexPath *indexPath = $(alloc(IndexPath), initWithIndex, i);
+
+			CollectionItemView *item = self->delegate.itemForObjectAtIndexPath(self, indexPath);
+			assert(item);
+
+			$(self->items, addObject, item);
+			$(self->contentView, addSubview, (View *) item);
+
+			release(item);
+			release(indexPath);
+		}
 	}
 
-	self->control.view.needsLayout = true;
+	$((View *) self, setNeedsLayout);
 }
 
 /**
@@ -403,6 +611,9 @@ static void selectAll_enumerate(const Array *array, ident obj, ident data) {
  * @memberof CollectionView
  */
 static void selectAll(CollectionView *self) {
+
+	$(self->selectedItems, addIndexesInRange, (Range) { .location = 0, .length = self->numberOfItems });
+
 	$((Array *) self->items, enumerateObjects, selectAll_enumerate, NULL);
 }
 
@@ -414,17 +625,13 @@ static Array *selectionIndexPaths(const CollectionView *self) {
 
 	MutableArray *array = $$(MutableArray, array);
 
-	const Array *items = (Array *) self->items;
-	for (size_t i = 0; i < items->count; i++) {
+	const IndexSet *selectedItems = (IndexSet *) self->selectedItems;
+	for (size_t i = 0; i < selectedItems->count; i++) {
 
-		const CollectionItemView *item = $(items, objectAtIndex, i);
-		if (item->isSelected) {
+		IndexPath *indexPath = $(alloc(IndexPath), initWithIndex, selectedItems->indexes[i]);
+		$(array, addObject, indexPath);
 
-			IndexPath *indexPath = $(self, indexPathForItem, item);
-			$(array, addObject, indexPath);
-
-			release(indexPath);
-		}
+		release(indexPath);
 	}
 
 	return (Array *) array;
@@ -437,6 +644,11 @@ static Array *selectionIndexPaths(const CollectionView *self) {
 static void selectItemAtIndexPath(CollectionView *self, const IndexPath *indexPath) {
 
 	if (indexPath) {
+		const size_t index = $(indexPath, indexAtPosition, 0);
+		if (index < self->numberOfItems) {
+			$(self->selectedItems, addIndex, index);
+		}
+
 		CollectionItemView *item = $(self, itemAtIndexPath, indexPath);
 		if (item) {
 			$(item, setSelected, true);
@@ -477,6 +689,7 @@ static void initialize(Class *clazz) {
 
 	((ControlInterface *) clazz->def->interface)->captureEvent = captureEvent;
 
+	((CollectionViewInterface *) clazz->def->interface)->dequeueReusableItem = dequeueReusableItem;
 	((CollectionViewInterface *) clazz->def->interface)->deselectAll = deselectAll;
 	((CollectionViewInterface *) clazz->def->interface)->deselectItemAtIndexPath = deselectItemAtIndexPath;
 	((CollectionViewInterface *) clazz->def->interface)->deselectItemsAtIndexPaths = deselectItemsAtIndexPaths;
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <Objectively/IndexPath.h>
+#include <Objectively/MutableIndexSet.h>
 
 #include <ObjectivelyMVC/Control.h>
 #include <ObjectivelyMVC/CollectionItemView.h>
@@ -106,6 +107,9 @@ struct CollectionViewDelegate {
 	 * @param collectionView The CollectionView.
 	 * @param indexPath The index path.
 	 * @return The item for the index path.
+	 * @remarks Virtualized CollectionViews call this function as items scroll into view.
+	 * Implementations should attempt to reuse an item via CollectionView::dequeueReusableItem
+	 * before allocating one.
 	 */
 	CollectionItemView *(*itemForObjectAtIndexPath)(const CollectionView *collectionView, const IndexPath *indexPath);
 };
@@ -115,6 +119,12 @@ struct CollectionViewDelegate {
 #define DEFAULT_COLLECTION_VIEW_VERTICAL_SPACING 10
 #define DEFAULT_COLLECTION_VIEW_ITEM_SIZE 48
 
+/**
+ * @brief The number of rows (or columns) of items materialized beyond the visible area of
+ * virtualized collections.
+ */
+#define COLLECTION_VIEW_VIRTUAL_OVERSCAN 2
+
 /**
  * @brief CollectionViews display items in a grid.
  * @extends Control
@@ -154,7 +164,15 @@ struct CollectionView {
 	CollectionViewDelegate delegate;
 
 	/**
-	 * @brief The items.
+	 * @brief The index of the first item in `items`.
+	 * @remarks This is always `0` unless the CollectionView is `virtualized`.
+	 */
+	size_t firstItem;
+
+	/**
+	 * @brief The materialized items.
+	 * @remarks If the CollectionView is `virtualized`, this contains only the items intersecting
+	 * the visible area of the ScrollView, beginning at `firstItem`.
 	 */
 	MutableArray *items;
 
@@ -168,10 +186,35 @@ struct CollectionView {
 	 */
 	SDL_Size itemSpacing;
 
+	/**
+	 * @brief The number of items reported by the data source at the last call to
+	 * CollectionView::reloadData.
+	 */
+	size_t numberOfItems;
+
+	/**
+	 * @brief Recycled items, awaiting reuse.
+	 * @remarks This queue holds at most one screen of items; the rest are released.
+	 * @private
+	 */
+	MutableArray *reusableItems;
+
 	/**
 	 * @brief The scroll view.
 	 */
 	ScrollView *scrollView;
+
+	/**
+	 * @brief The indexes of the selected items.
+	 * @private
+	 */
+	MutableIndexSet *selectedItems;
+
+	/**
+	 * @brief Set to `true` to materialize only the items intersecting the visible area of the
+	 * ScrollView, recycling them as the CollectionView is scrolled.
+	 */
+	_Bool virtualized;
 };
 
 /**
@@ -184,6 +227,15 @@ struct CollectionViewInterface {
 	 */
 	ControlInterface controlInterface;
 
+	/**
+	 * @fn CollectionItemView *CollectionView::dequeueReusableItem(CollectionView *self)
+	 * @brief Dequeues an item that has scrolled out of view for reuse.
+	 * @param self The CollectionView.
+	 * @return A retained CollectionItemView, or `NULL` if no item is available for reuse.
+	 * @memberof CollectionView
+	 */
+	CollectionItemView *(*dequeueReusableItem)(CollectionView *self);
+
 	/**
 	 * @fn void CollectionView::deselectAll(CollectionView *self)
 	 * @brief Deselects all items in this CollectionView.
@@ -244,6 +296,7 @@ struct CollectionViewInterface {
 	 * @param self The CollectionView.
 	 * @param indexPath An index path.
 	 * @return The item at the specified index path, or `NULL`.
+	 * @remarks For virtualized CollectionViews, this returns `NULL` for items not in view.
 	 * @memberof CollectionView
 	 */
 	CollectionItemView *(*itemAtIndexPath)(const CollectionView *self, const IndexPath *indexPath);
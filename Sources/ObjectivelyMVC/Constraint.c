@@ -22,11 +22,10 @@
  */
 
 #include <assert.h>
+#include <ctype.h>
+#include <stdlib.h>
 #include <string.h>
 
-#include <Objectively/MutableString.h>
-#include <Objectively/Regexp.h>
-
 #include <ObjectivelyMVC/Constraint.h>
 #include <ObjectivelyMVC/Log.h>
 #include <ObjectivelyMVC/View.h>
@@ -79,23 +78,236 @@ static ConstraintRelation constraintRelation(const char *s) {
 	return ConstraintRelationNone;
 }
 
-#define _Class _Constraint
+/**
+ * @brief A parsed Constraint descriptor, shared by all Constraints initialized with it.
+ */
+typedef struct {
+
+	/**
+	 * @brief The interned descriptor, or `NULL` for an empty slot.
+	 */
+	char *descriptor;
+
+	/**
+	 * @brief The hash of `descriptor`.
+	 */
+	unsigned int hash;
+
+	/**
+	 * @brief The interned identifier, or `NULL`.
+	 */
+	char *identifier;
+
+	ConstraintAttribute target;
+	ConstraintRelation relation;
+	ConstraintAttribute source;
+	float multiplier;
+	float constant;
+	int priority;
+} ConstraintTemplate;
+
+/**
+ * @brief The ConstraintTemplates, in an open-addressed hash table keyed by descriptor.
+ */
+static struct {
+	ConstraintTemplate *templates;
+	size_t count, capacity;
+} _cache;
+
+/**
+ * @return The FNV-1a hash of `s`.
+ */
+static unsigned int hashDescriptor(const char *s) {
+
+	unsigned int hash = 2166136261u;
+	while (*s) {
+		hash = (hash ^ (unsigned char) *s++) * 16777619u;
+	}
+
+	return hash;
+}
+
+/**
+ * @return The slot for `descriptor` in the cache, which is empty if it has not been parsed.
+ */
+static ConstraintTemplate *cacheSlot(const char *descriptor, unsigned int hash) {
+
+	const size_t mask = _cache.capacity - 1;
+
+	for (size_t i = hash & mask;; i = (i + 1) & mask) {
+		ConstraintTemplate *template = &_cache.templates[i];
+		if (template->descriptor == NULL) {
+			return template;
+		}
+		if (template->hash == hash && strcmp(template->descriptor, descriptor) == 0) {
+			return template;
+		}
+	}
+}
+
+/**
+ * @brief Doubles the capacity of the cache, rehashing its ConstraintTemplates.
+ */
+static void growCache(void) {
+
+	ConstraintTemplate *templates = _cache.templates;
+	const size_t capacity = _cache.capacity;
+
+	_cache.capacity = capacity ? capacity * 2 : 64;
+	_cache.templates = calloc(_cache.capacity, sizeof(ConstraintTemplate));
+	assert(_cache.templates);
+
+	for (size_t i = 0; i < capacity; i++) {
+		if (templates[i].descriptor) {
+			*cacheSlot(templates[i].descriptor, templates[i].hash) = templates[i];
+		}
+	}
+
+	free(templates);
+}
+
+/**
+ * @return The length of the span of numeric characters at `s`.
+ */
+static size_t numericSpan(const char *s) {
+	return strspn(s, "0123456789.");
+}
+
+/**
+ * @brief Parses `descriptor` in a single pass.
+ * @details The grammar, ignoring spaces and case, is:
+ *
+ *   `target relation [identifier.][source][*multiplier][+|-constant][[priority]]`
+ *
+ * @param template The ConstraintTemplate to populate, whose `descriptor` is already interned.
+ * @return True on success, false if `descriptor` is malformed.
+ */
+static _Bool parseDescriptor(ConstraintTemplate *template) {
+
+	char *s = strdup(template->descriptor);
+	assert(s);
+
+	char *end = s;
+	for (const char *c = s; *c; c++) {
+		if (*c != ' ') {
+			*end++ = *c;
+		}
+	}
+	*end = '\0';
+
+	template->multiplier = 1.0f;
+	template->priority = DEFAULT_CONSTRAINT_PRIORITY;
+
+	const char *c = s;
+
+	template->target = constraintAttribute(c);
+	if (template->target == ConstraintAttributeNone) {
+		goto fail;
+	}
+	c++;
+
+	template->relation = constraintRelation(c);
+	if (template->relation == ConstraintRelationNone) {
+		goto fail;
+	}
+	c += strspn(c, "<=>");
+
+	size_t length = 0;
+	while (isalpha(c[length])) {
+		length++;
+	}
+
+	if (length && c[length] == '.') {
+		template->identifier = strndup(c, length);
+		assert(template->identifier);
+		c += length + 1;
+	}
+
+	template->source = constraintAttribute(c);
+	if (template->source) {
+		c++;
+	}
+
+	if (*c == '*') {
+		template->multiplier = strtof(c + 1, NULL);
+		assert(template->multiplier);
+		c += 1 + numericSpan(c + 1);
+	}
+
+	length = (*c == '+' || *c == '-') ? 1 : 0;
+	if (numericSpan(c + length)) {
+		template->constant = strtof(c, NULL);
+		assert(template->constant);
+		c += length + numericSpan(c + length);
+	} else if (length) {
+		goto fail;
+	}
+
+	if (*c == '[') {
+		length = numericSpan(c + 1);
+		if (length == 0 || c[1 + length] != ']') {
+			goto fail;
+		}
+		template->priority = (int) strtol(c + 1, NULL, 10);
+		assert(template->priority);
+		c += length + 2;
+	}
+
+	if (*c) {
+		goto fail;
+	}
+
+	free(s);
+	return true;
+
+fail:
+	free(template->identifier);
+	template->identifier = NULL;
 
-#pragma mark - Object
+	free(s);
+	return false;
+}
 
 /**
- * @see Object::dealloc(Object *)
+ * @return The cached ConstraintTemplate for `descriptor`, parsing it on first use, or `NULL` if
+ * `descriptor` is malformed.
  */
-static void dealloc(Object *self) {
+static const ConstraintTemplate *templateForDescriptor(const char *descriptor) {
+
+	const unsigned int hash = hashDescriptor(descriptor);
+
+	if (_cache.capacity) {
+		const ConstraintTemplate *template = cacheSlot(descriptor, hash);
+		if (template->descriptor) {
+			return template;
+		}
+	}
+
+	ConstraintTemplate parsed = {
+		.descriptor = strdup(descriptor),
+		.hash = hash
+	};
+	assert(parsed.descriptor);
 
-	Constraint *this = (Constraint *) self;
+	if (parseDescriptor(&parsed) == false) {
+		free(parsed.descriptor);
+		return NULL;
+	}
 
-	free(this->descriptor);
-	free(this->identifier);
+	if ((_cache.count + 1) * 2 > _cache.capacity) {
+		growCache();
+	}
 
-	super(Object, self, dealloc);
+	ConstraintTemplate *template = cacheSlot(descriptor, hash);
+	*template = parsed;
+
+	_cache.count++;
+
+	return template;
 }
 
+#define _Class _Constraint
+
 #pragma mark - Constraint
 
 /**
@@ -105,22 +317,9 @@ static void dealloc(Object *self) {
 static void apply(const Constraint *self, View *view) {
 
 	int value = 0;
-	View *source = view;
 
-	if (self->identifier) {
-		if (strcmp(self->identifier, "superview") == 0) {
-			source = view->superview;
-		} else {
-			source = $(view, ancestorWithIdentifier, self->identifier);
-			if (source == NULL) {
-				if (view->superview) {
-					source = $(view->superview, subviewWithIdentifier, self->identifier);
-				}
-			}
-		}
-
-		assert(source);
-	}
+	const View *source = self->sourceView ?: $(self, sourceForView, view);
+	assert(source);
 
 	switch (self->source) {
 		case ConstraintAttributeNone:
@@ -191,84 +390,61 @@ static void apply(const Constraint *self, View *view) {
 	}
 }
 
-static Regexp *_re;
-
 /**
  * @fn Constraint *Constraint::initWithTarget(Constraint *self, const char *descriptor)
  * @memberof Constraint
  */
 static Constraint *initWithDescriptor(Constraint *self, const char *descriptor) {
 
+	assert(descriptor);
+
 	self = (Constraint *) super(Object, self, init);
 	if (self) {
 
-		self->descriptor = strdup(descriptor);
-		assert(self->descriptor);
-
-		self->enabled = true;
-
-		self->multiplier = 1.0f;
-
-		self->priority = DEFAULT_CONSTRAINT_PRIORITY;
-
-		String *string = (String *) mstr(self->descriptor);
-		$((MutableString *) string, replaceOccurrencesOfCharacters, " ", "");
+		const ConstraintTemplate *template = templateForDescriptor(descriptor);
+		if (template) {
+			self->descriptor = template->descriptor;
+			self->identifier = template->identifier;
 
-		Range *ranges;
-		if ($(_re, matchesString, string, 0, &ranges)) {
+			self->enabled = true;
 
-			const Range *target = &ranges[1];
-			const Range *relation = &ranges[2];
-			const Range *identifier = &ranges[3];
-			const Range *source = &ranges[4];
-			const Range *multiplier = &ranges[5];
-			const Range *constant = &ranges[6];
-			const Range *priority = &ranges[7];
-
-			assert(target->location != -1);
-			assert(relation->location != -1);
-
-			self->target = constraintAttribute(string->chars + target->location);
-			assert(self->target);
-
-			self->relation = constraintRelation(string->chars + relation->location);
-			assert(self->relation);
-
-			if (identifier->location != -1) {
-				self->identifier = calloc(identifier->length, 1);
-				assert(self->identifier);
+			self->target = template->target;
+			self->relation = template->relation;
+			self->source = template->source;
+			self->multiplier = template->multiplier;
+			self->constant = template->constant;
+			self->priority = template->priority;
+		} else {
+			release(self);
+			self = NULL;
+		}
+	}
 
-				strncpy(self->identifier, string->chars + identifier->location, identifier->length - 1);
-			}
+	return self;
+}
 
-			if (source->location != -1) {
-				self->source = constraintAttribute(string->chars + source->location);
-				assert(self->source);
-			}
+/**
+ * @fn View *Constraint::sourceForView(const Constraint *self, View *view)
+ * @memberof Constraint
+ */
+static View *sourceForView(const Constraint *self, View *view) {
 
-			if (multiplier->location != -1) {
-				self->multiplier = strtof(string->chars + multiplier->location + 1, NULL);
-				assert(self->multiplier);
-			}
+	if (self->identifier == NULL) {
+		return view;
+	}
 
-			if (constant->location != -1) {
-				self->constant = strtof(string->chars + constant->location, NULL);
-				assert(self->constant);
-			}
+	if (strcmp(self->identifier, "superview") == 0) {
+		return view->superview;
+	}
 
-			if (priority->location != -1) {
-				self->priority = (int) strtol(string->chars + priority->location + 1, NULL, 10);
-				assert(self->priority);
-			}
-		} else {
-			release(self);
-			self = NULL;
+	View *source = $(view, ancestorWithIdentifier, self->identifier);
+	if (source == NULL) {
+		if (view->superview) {
+			source = $(view->superview, subviewWithIdentifier, self->identifier);
 		}
-		
-		release(string);
 	}
 
-	return self;
+	return source;
 }
 
 #pragma mark - Class lifecycle
@@ -278,19 +454,23 @@ static Constraint *initWithDescriptor(Constraint *self, const char *descriptor)
  */
 static void initialize(Class *clazz) {
 
-	((ObjectInterface *) clazz->def->interface)->dealloc = dealloc;
-
 	((ConstraintInterface *) clazz->def->interface)->apply = apply;
 	((ConstraintInterface *) clazz->def->interface)->initWithDescriptor = initWithDescriptor;
-
-	_re = re("^([whtrblc])([<=>]+)([a-z]+\\.)?([whtrblc])?(\\*[0-9.]*)?([+|-]?[0-9.]+)?(\\[[0-9.]+\\])?$", REG_ICASE);
+	((ConstraintInterface *) clazz->def->interface)->sourceForView = sourceForView;
 }
 
 /**
  * @see Class::destroy(Class *)
  */
 static void destroy(Class *clazz) {
-	release(_re);
+
+	for (size_t i = 0; i < _cache.capacity; i++) {
+		free(_cache.templates[i].descriptor);
+		free(_cache.templates[i].identifier);
+	}
+
+	free(_cache.templates);
+	memset(&_cache, 0, sizeof(_cache));
 }
 
 /**
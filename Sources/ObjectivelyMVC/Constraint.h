@@ -101,13 +101,15 @@ struct Constraint {
 
 	/**
 	 * @brief The descriptor.
+	 * @remarks This string is interned, and shared by all Constraints with the same descriptor.
 	 */
-	char *descriptor;
+	const char *descriptor;
 
 	/**
 	 * @brief The identifier of the View enforcing this Constraint.
+	 * @remarks This string is interned, and shared by all Constraints with the same descriptor.
 	 */
-	char *identifier;
+	const char *identifier;
 
 	/**
 	 * @brief The multiplier.
@@ -124,15 +126,35 @@ struct Constraint {
 	 */
 	ConstraintRelation relation;
 
+	/**
+	 * @brief The handle of this Constraint in the ConstraintSolver of its View hierarchy, or 0.
+	 * @private
+	 */
+	unsigned int solverConstraint;
+
 	/**
 	 * @brief The attribute to constrain against.
 	 */
 	ConstraintAttribute source;
 
+	/**
+	 * @brief The View resolved from `identifier` when this Constraint was added to the solver.
+	 * @details This weak reference is valid until the hierarchy changes, at which point this
+	 * Constraint is removed from the solver and resolved again.
+	 * @private
+	 */
+	View *sourceView;
+
 	/**
 	 * @brief The attribute to constrain.
 	 */
 	ConstraintAttribute target;
+
+	/**
+	 * @brief The hierarchy generation at which `identifier` last failed to resolve, or 0.
+	 * @private
+	 */
+	unsigned int unresolvedGeneration;
 };
 
 /**
@@ -147,11 +169,11 @@ struct ConstraintInterface {
 
 	/**
 	 * @fn void Constraint::apply(const Constraint *self, View *view)
-	 * @brief Applies this Constraint on the specified View.
+	 * @brief Applies this Constraint on the specified View, in isolation.
 	 * @param self The Constraint.
 	 * @param view The View to constrain.
-	 * @remarks Any Views referenced in this Constraint's descriptor are resolved from the View's 
-	 * hierarchy. Ancestors and immediate siblings are supported.
+	 * @remarks Views solve their Constraints together, via the ConstraintSolver of their hierarchy.
+	 * This method simply assigns the target attribute, and ignores `relation` and `priority`.
 	 * @memberof Constraint
 	 */
 	void (*apply)(const Constraint *self, View *view);
@@ -162,9 +184,21 @@ struct ConstraintInterface {
 	 * @param self The Constraint.
 	 * @param descriptor The Constraint descriptor.
 	 * @return The initialized Constraint, or `NULL` on error.
+	 * @remarks Descriptors are parsed once, and cached for the lifetime of the Constraint class.
 	 * @memberof Constraint
 	 */
 	Constraint *(*initWithDescriptor)(Constraint *self, const char *descriptor);
+
+	/**
+	 * @fn View *Constraint::sourceForView(const Constraint *self, View *view)
+	 * @param self The Constraint.
+	 * @param view The View to constrain.
+	 * @return The View whose attribute this Constraint reads, or `NULL` if it can not be resolved.
+	 * @remarks Any Views referenced in this Constraint's descriptor are resolved from the View's
+	 * hierarchy. Ancestors and immediate siblings are supported.
+	 * @memberof Constraint
+	 */
+	View *(*sourceForView)(const Constraint *self, View *view);
 };
 
 /**
@@ -0,0 +1,1099 @@
+/*
+ * ObjectivelyMVC: MVC framework for OpenGL and SDL2 in c.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <ObjectivelyMVC/ConstraintSolver.h>
+#include <ObjectivelyMVC/Log.h>
+
+/**
+ * @brief The types of symbols in the tableau.
+ */
+typedef enum {
+	SymbolTypeInvalid,
+	SymbolTypeExternal,
+	SymbolTypeSlack,
+	SymbolTypeError,
+	SymbolTypeDummy
+} SymbolType;
+
+/**
+ * @brief A symbol, by its index in ConstraintSolver::symbols, or 0.
+ */
+typedef unsigned int Symbol;
+
+/**
+ * @brief A symbol and its coefficient within a Row.
+ */
+typedef struct {
+	Symbol symbol;
+	double coefficient;
+} Cell;
+
+/**
+ * @brief A row of the tableau: `basic = constant + cells`.
+ */
+typedef struct ConstraintSolverRow {
+	double constant;
+	Cell *cells;
+	size_t count, capacity;
+} Row;
+
+/**
+ * @brief A symbol of the tableau.
+ */
+struct ConstraintSolverSymbol {
+
+	/**
+	 * @brief The type.
+	 */
+	SymbolType type;
+
+	/**
+	 * @brief The Row for which this symbol is basic, or `NULL`.
+	 */
+	Row *row;
+
+	/**
+	 * @brief The index of this symbol in ConstraintSolver::basic, if it is basic.
+	 */
+	size_t index;
+
+	/**
+	 * @brief The next released symbol, if this symbol has been released.
+	 */
+	Symbol next;
+
+	/**
+	 * @brief The edit constraint, if this symbol is an edit variable.
+	 */
+	SolverConstraint edit;
+
+	/**
+	 * @brief The value most recently suggested for this edit variable.
+	 */
+	double suggestion;
+};
+
+/**
+ * @brief The symbols introduced by a constraint, by which it is later removed or edited.
+ */
+struct ConstraintSolverTag {
+
+	/**
+	 * @brief The marker symbol, or 0 if this constraint has been removed.
+	 */
+	Symbol marker;
+
+	/**
+	 * @brief The other symbol, for non-required constraints.
+	 */
+	Symbol other;
+
+	/**
+	 * @brief The strength.
+	 */
+	double strength;
+
+	/**
+	 * @brief The next removed constraint, if this constraint has been removed.
+	 */
+	SolverConstraint next;
+};
+
+/**
+ * @return True if `value` is indistinguishable from zero.
+ */
+static _Bool nearZero(double value) {
+	return fabs(value) < 1.0e-8;
+}
+
+#define _Class _ConstraintSolver
+
+#pragma mark - Rows
+
+/**
+ * @return A new Row with the given constant.
+ */
+static Row *allocRow(double constant) {
+
+	Row *row = calloc(1, sizeof(Row));
+	assert(row);
+
+	row->constant = constant;
+	return row;
+}
+
+/**
+ * @return A copy of the given Row.
+ */
+static Row *copyRow(const Row *row) {
+
+	Row *copy = allocRow(row->constant);
+
+	if (row->count) {
+		copy->cells = malloc(row->count * sizeof(Cell));
+		assert(copy->cells);
+
+		memcpy(copy->cells, row->cells, row->count * sizeof(Cell));
+		copy->count = copy->capacity = row->count;
+	}
+
+	return copy;
+}
+
+/**
+ * @brief Frees the given Row.
+ */
+static void freeRow(Row *row) {
+
+	if (row) {
+		free(row->cells);
+		free(row);
+	}
+}
+
+/**
+ * @return The index of `symbol` in `row`, or -1.
+ */
+static ssize_t indexOfSymbol(const Row *row, Symbol symbol) {
+
+	for (size_t i = 0; i < row->count; i++) {
+		if (row->cells[i].symbol == symbol) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+/**
+ * @return The coefficient of `symbol` in `row`, or 0.
+ */
+static double coefficientFor(const Row *row, Symbol symbol) {
+
+	const ssize_t index = indexOfSymbol(row, symbol);
+	return index == -1 ? 0.0 : row->cells[index].coefficient;
+}
+
+/**
+ * @brief Removes the cell at `index` from `row`.
+ */
+static void removeCell(Row *row, size_t index) {
+	row->cells[index] = row->cells[--row->count];
+}
+
+/**
+ * @brief Removes `symbol` from `row`, if present.
+ */
+static void removeSymbol(Row *row, Symbol symbol) {
+
+	const ssize_t index = indexOfSymbol(row, symbol);
+	if (index != -1) {
+		removeCell(row, index);
+	}
+}
+
+/**
+ * @brief Adds `coefficient` to the coefficient of `symbol` in `row`.
+ */
+static void insertSymbol(Row *row, Symbol symbol, double coefficient) {
+
+	const ssize_t index = indexOfSymbol(row, symbol);
+	if (index == -1) {
+		if (nearZero(coefficient)) {
+			return;
+		}
+
+		if (row->count == row->capacity) {
+			row->capacity = row->capacity ? row->capacity * 2 : 4;
+			row->cells = realloc(row->cells, row->capacity * sizeof(Cell));
+			assert(row->cells);
+		}
+
+		row->cells[row->count++] = (Cell) { .symbol = symbol, .coefficient = coefficient };
+	} else {
+		row->cells[index].coefficient += coefficient;
+		if (nearZero(row->cells[index].coefficient)) {
+			removeCell(row, index);
+		}
+	}
+}
+
+/**
+ * @brief Adds `other`, multiplied by `coefficient`, to `row`.
+ */
+static void insertRow(Row *row, const Row *other, double coefficient) {
+
+	row->constant += other->constant * coefficient;
+
+	for (size_t i = 0; i < other->count; i++) {
+		insertSymbol(row, other->cells[i].symbol, other->cells[i].coefficient * coefficient);
+	}
+}
+
+/**
+ * @brief Negates the constant and coefficients of `row`.
+ */
+static void reverseSign(Row *row) {
+
+	row->constant = -row->constant;
+
+	for (size_t i = 0; i < row->count; i++) {
+		row->cells[i].coefficient = -row->cells[i].coefficient;
+	}
+}
+
+/**
+ * @brief Solves `row` for `symbol`, which must be present in it.
+ * @details Given `0 = constant + a * symbol + cells`, `row` becomes `symbol = -(constant + cells) / a`.
+ */
+static void solveFor(Row *row, Symbol symbol) {
+
+	const ssize_t index = indexOfSymbol(row, symbol);
+	assert(index != -1);
+
+	const double coefficient = -1.0 / row->cells[index].coefficient;
+	removeCell(row, index);
+
+	row->constant *= coefficient;
+
+	for (size_t i = 0; i < row->count; i++) {
+		row->cells[i].coefficient *= coefficient;
+	}
+}
+
+/**
+ * @brief Solves `row`, for which `lhs` is basic, for `rhs` instead.
+ */
+static void solveForSymbols(Row *row, Symbol lhs, Symbol rhs) {
+
+	insertSymbol(row, lhs, -1.0);
+	solveFor(row, rhs);
+}
+
+/**
+ * @brief Replaces `symbol` in `row` with the expression `other`.
+ */
+static void substituteRow(Row *row, Symbol symbol, const Row *other) {
+
+	const ssize_t index = indexOfSymbol(row, symbol);
+	if (index != -1) {
+		const double coefficient = row->cells[index].coefficient;
+		removeCell(row, index);
+		insertRow(row, other, coefficient);
+	}
+}
+
+#pragma mark - Tableau
+
+/**
+ * @return A new symbol of the given type, reusing a released symbol if possible.
+ */
+static Symbol createSymbol(ConstraintSolver *self, SymbolType type) {
+
+	Symbol symbol = self->freeSymbols;
+	if (symbol) {
+		self->freeSymbols = self->symbols[symbol].next;
+	} else {
+		if (self->symbolCount == self->symbolCapacity) {
+			self->symbolCapacity = self->symbolCapacity ? self->symbolCapacity * 2 : 64;
+			self->symbols = realloc(self->symbols, self->symbolCapacity * sizeof(ConstraintSolverSymbol));
+			assert(self->symbols);
+		}
+
+		symbol = (Symbol) self->symbolCount++;
+	}
+
+	self->symbols[symbol] = (ConstraintSolverSymbol) { .type = type };
+
+	return symbol;
+}
+
+/**
+ * @brief Releases the non-basic `symbol` for reuse, removing any residue of it from the tableau.
+ */
+static void releaseSymbol(ConstraintSolver *self, Symbol symbol) {
+
+	assert(symbol && self->symbols[symbol].row == NULL);
+
+	for (size_t i = 0; i < self->basicCount; i++) {
+		removeSymbol(self->symbols[self->basic[i]].row, symbol);
+	}
+
+	removeSymbol(self->objective, symbol);
+
+	self->symbols[symbol] = (ConstraintSolverSymbol) {
+		.type = SymbolTypeInvalid,
+		.next = self->freeSymbols
+	};
+
+	self->freeSymbols = symbol;
+}
+
+/**
+ * @brief Makes `symbol` basic for `row`.
+ */
+static void setRow(ConstraintSolver *self, Symbol symbol, Row *row) {
+
+	assert(self->symbols[symbol].row == NULL);
+
+	if (self->basicCount == self->basicCapacity) {
+		self->basicCapacity = self->basicCapacity ? self->basicCapacity * 2 : 64;
+		self->basic = realloc(self->basic, self->basicCapacity * sizeof(Symbol));
+		assert(self->basic);
+	}
+
+	self->symbols[symbol].row = row;
+	self->symbols[symbol].index = self->basicCount;
+
+	self->basic[self->basicCount++] = symbol;
+}
+
+/**
+ * @brief Makes the basic `symbol` non-basic.
+ * @return The Row for which `symbol` was basic.
+ */
+static Row *takeRow(ConstraintSolver *self, Symbol symbol) {
+
+	ConstraintSolverSymbol *sym = &self->symbols[symbol];
+	assert(sym->row);
+
+	const Symbol last = self->basic[--self->basicCount];
+
+	self->basic[sym->index] = last;
+	self->symbols[last].index = sym->index;
+
+	Row *row = sym->row;
+	sym->row = NULL;
+
+	return row;
+}
+
+/**
+ * @return The type of `symbol`.
+ */
+static SymbolType typeOf(const ConstraintSolver *self, Symbol symbol) {
+	return self->symbols[symbol].type;
+}
+
+/**
+ * @brief Queues the row for which `symbol` is basic for dual optimization.
+ */
+static void markInfeasible(ConstraintSolver *self, Symbol symbol) {
+
+	if (self->infeasibleCount == self->infeasibleCapacity) {
+		self->infeasibleCapacity = self->infeasibleCapacity ? self->infeasibleCapacity * 2 : 16;
+		self->infeasible = realloc(self->infeasible, self->infeasibleCapacity * sizeof(Symbol));
+		assert(self->infeasible);
+	}
+
+	self->infeasible[self->infeasibleCount++] = symbol;
+}
+
+/**
+ * @brief Replaces `symbol` with the expression `row` throughout the tableau.
+ */
+static void substitute(ConstraintSolver *self, Symbol symbol, const Row *row) {
+
+	for (size_t i = 0; i < self->basicCount; i++) {
+
+		const Symbol s = self->basic[i];
+		Row *r = self->symbols[s].row;
+
+		substituteRow(r, symbol, row);
+		if (typeOf(self, s) != SymbolTypeExternal && r->constant < 0.0) {
+			markInfeasible(self, s);
+		}
+	}
+
+	substituteRow(self->objective, symbol, row);
+
+	if (self->artificial) {
+		substituteRow(self->artificial, symbol, row);
+	}
+}
+
+/**
+ * @brief Pivots `entering` into the basis, in place of `leaving`.
+ */
+static void pivot(ConstraintSolver *self, Symbol leaving, Symbol entering) {
+
+	Row *row = takeRow(self, leaving);
+
+	solveForSymbols(row, leaving, entering);
+	substitute(self, entering, row);
+
+	setRow(self, entering, row);
+}
+
+/**
+ * @return The non-dummy symbol of `objective` with a negative coefficient, or 0.
+ */
+static Symbol enteringSymbol(const ConstraintSolver *self, const Row *objective) {
+
+	for (size_t i = 0; i < objective->count; i++) {
+		const Cell *cell = &objective->cells[i];
+		if (typeOf(self, cell->symbol) != SymbolTypeDummy && cell->coefficient < 0.0) {
+			return cell->symbol;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @return The symbol of `row` which best restores feasibility during dual optimization, or 0.
+ */
+static Symbol dualEnteringSymbol(const ConstraintSolver *self, const Row *row) {
+
+	Symbol entering = 0;
+	double ratio = DBL_MAX;
+
+	for (size_t i = 0; i < row->count; i++) {
+		const Cell *cell = &row->cells[i];
+		if (cell->coefficient > 0.0 && typeOf(self, cell->symbol) != SymbolTypeDummy) {
+			const double r = coefficientFor(self->objective, cell->symbol) / cell->coefficient;
+			if (r < ratio) {
+				ratio = r;
+				entering = cell->symbol;
+			}
+		}
+	}
+
+	return entering;
+}
+
+/**
+ * @return The basic symbol of the row which most restricts `entering`, or 0 if it is unbounded.
+ */
+static Symbol leavingSymbol(const ConstraintSolver *self, Symbol entering) {
+
+	Symbol leaving = 0;
+	double ratio = DBL_MAX;
+
+	for (size_t i = 0; i < self->basicCount; i++) {
+
+		const Symbol s = self->basic[i];
+		const Row *row = self->symbols[s].row;
+
+		if (typeOf(self, s) != SymbolTypeExternal) {
+			const double coefficient = coefficientFor(row, entering);
+			if (coefficient < 0.0) {
+				const double r = -row->constant / coefficient;
+				if (r < ratio) {
+					ratio = r;
+					leaving = s;
+				}
+			}
+		}
+	}
+
+	return leaving;
+}
+
+/**
+ * @return The basic symbol of the row from which the non-basic `marker` should be pivoted.
+ */
+static Symbol markerLeavingSymbol(const ConstraintSolver *self, Symbol marker) {
+
+	Symbol first = 0, second = 0, third = 0;
+	double r1 = DBL_MAX, r2 = DBL_MAX;
+
+	for (size_t i = 0; i < self->basicCount; i++) {
+
+		const Symbol s = self->basic[i];
+		const Row *row = self->symbols[s].row;
+
+		const double coefficient = coefficientFor(row, marker);
+		if (coefficient == 0.0) {
+			continue;
+		}
+
+		if (typeOf(self, s) == SymbolTypeExternal) {
+			third = s;
+		} else if (coefficient < 0.0) {
+			const double r = -row->constant / coefficient;
+			if (r < r1) {
+				r1 = r;
+				first = s;
+			}
+		} else {
+			const double r = row->constant / coefficient;
+			if (r < r2) {
+				r2 = r;
+				second = s;
+			}
+		}
+	}
+
+	return first ?: second ?: third;
+}
+
+/**
+ * @brief Optimizes `objective` with the primal simplex method.
+ */
+static void optimize(ConstraintSolver *self, const Row *objective) {
+
+	while (true) {
+
+		const Symbol entering = enteringSymbol(self, objective);
+		if (entering == 0) {
+			break;
+		}
+
+		const Symbol leaving = leavingSymbol(self, entering);
+		if (leaving == 0) {
+			MVC_LogError("The objective is unbounded\n");
+			break;
+		}
+
+		pivot(self, leaving, entering);
+	}
+}
+
+/**
+ * @brief Restores the feasibility of rows invalidated by an edit with the dual simplex method.
+ */
+static void dualOptimize(ConstraintSolver *self) {
+
+	while (self->infeasibleCount) {
+
+		const Symbol leaving = self->infeasible[--self->infeasibleCount];
+
+		const Row *row = self->symbols[leaving].row;
+		if (row && nearZero(row->constant) == false && row->constant < 0.0) {
+
+			const Symbol entering = dualEnteringSymbol(self, row);
+			if (entering == 0) {
+				MVC_LogError("Dual optimization failed\n");
+				self->infeasibleCount = 0;
+				break;
+			}
+
+			pivot(self, leaving, entering);
+		}
+	}
+}
+
+/**
+ * @return A new Row for the given expression, with the slack and error symbols for `relation`.
+ */
+static Row *createRow(ConstraintSolver *self, const SolverTerm *terms, size_t count, double constant, ConstraintRelation relation, ConstraintSolverTag *tag) {
+
+	Row *row = allocRow(constant);
+
+	for (size_t i = 0; i < count; i++) {
+
+		const SolverTerm *term = &terms[i];
+		if (nearZero(term->coefficient)) {
+			continue;
+		}
+
+		assert(term->variable && term->variable < self->symbolCount);
+		assert(typeOf(self, term->variable) == SymbolTypeExternal);
+
+		const Row *basic = self->symbols[term->variable].row;
+		if (basic) {
+			insertRow(row, basic, term->coefficient);
+		} else {
+			insertSymbol(row, term->variable, term->coefficient);
+		}
+	}
+
+	switch (relation) {
+		case ConstraintRelationLessThan:
+		case ConstraintRelationLessThanOrEqual:
+		case ConstraintRelationGreaterThan:
+		case ConstraintRelationGreaterThanOrEqual: {
+
+			const double coefficient = relation <= ConstraintRelationLessThanOrEqual ? 1.0 : -1.0;
+
+			tag->marker = createSymbol(self, SymbolTypeSlack);
+			insertSymbol(row, tag->marker, coefficient);
+
+			if (tag->strength < SOLVER_STRENGTH_REQUIRED) {
+				tag->other = createSymbol(self, SymbolTypeError);
+				insertSymbol(row, tag->other, -coefficient);
+				insertSymbol(self->objective, tag->other, tag->strength);
+			}
+		}
+			break;
+
+		default:
+			if (tag->strength < SOLVER_STRENGTH_REQUIRED) {
+				tag->marker = createSymbol(self, SymbolTypeError);
+				tag->other = createSymbol(self, SymbolTypeError);
+				insertSymbol(row, tag->marker, -1.0);
+				insertSymbol(row, tag->other, 1.0);
+				insertSymbol(self->objective, tag->marker, tag->strength);
+				insertSymbol(self->objective, tag->other, tag->strength);
+			} else {
+				tag->marker = createSymbol(self, SymbolTypeDummy);
+				insertSymbol(row, tag->marker, 1.0);
+			}
+			break;
+	}
+
+	if (row->constant < 0.0) {
+		reverseSign(row);
+	}
+
+	return row;
+}
+
+/**
+ * @return The symbol for which `row` should be solved when it is added to the tableau, or 0.
+ */
+static Symbol chooseSubject(const ConstraintSolver *self, const Row *row, const ConstraintSolverTag *tag) {
+
+	for (size_t i = 0; i < row->count; i++) {
+		if (typeOf(self, row->cells[i].symbol) == SymbolTypeExternal) {
+			return row->cells[i].symbol;
+		}
+	}
+
+	const Symbol candidates[] = { tag->marker, tag->other };
+	for (size_t i = 0; i < lengthof(candidates); i++) {
+
+		const Symbol symbol = candidates[i];
+		if (symbol == 0) {
+			continue;
+		}
+
+		const SymbolType type = typeOf(self, symbol);
+		if (type == SymbolTypeSlack || type == SymbolTypeError) {
+			if (coefficientFor(row, symbol) < 0.0) {
+				return symbol;
+			}
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @return True if `row` contains only dummy symbols.
+ */
+static _Bool allDummies(const ConstraintSolver *self, const Row *row) {
+
+	for (size_t i = 0; i < row->count; i++) {
+		if (typeOf(self, row->cells[i].symbol) != SymbolTypeDummy) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @brief Adds `row` to the tableau via an artificial variable.
+ * @return True if `row` is satisfiable, false otherwise.
+ */
+static _Bool addWithArtificialVariable(ConstraintSolver *self, const Row *row) {
+
+	const Symbol artificial = createSymbol(self, SymbolTypeSlack);
+
+	setRow(self, artificial, copyRow(row));
+	self->artificial = copyRow(row);
+
+	optimize(self, self->artificial);
+
+	const _Bool success = nearZero(self->artificial->constant);
+
+	freeRow(self->artificial);
+	self->artificial = NULL;
+
+	const Row *r = self->symbols[artificial].row;
+	if (r) {
+
+		Symbol entering = 0;
+		for (size_t i = 0; i < r->count; i++) {
+			const SymbolType type = typeOf(self, r->cells[i].symbol);
+			if (type == SymbolTypeSlack || type == SymbolTypeError) {
+				entering = r->cells[i].symbol;
+				break;
+			}
+		}
+
+		if (entering == 0) {
+			const _Bool empty = r->count == 0;
+
+			freeRow(takeRow(self, artificial));
+			releaseSymbol(self, artificial);
+
+			return empty && success;
+		}
+
+		pivot(self, artificial, entering);
+	}
+
+	releaseSymbol(self, artificial);
+
+	return success;
+}
+
+/**
+ * @brief Removes the contribution of the error symbol `marker` from the objective.
+ */
+static void removeMarkerEffects(ConstraintSolver *self, Symbol marker, double strength) {
+
+	const Row *row = self->symbols[marker].row;
+	if (row) {
+		insertRow(self->objective, row, -strength);
+	} else {
+		insertSymbol(self->objective, marker, -strength);
+	}
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	ConstraintSolver *this = (ConstraintSolver *) self;
+
+	for (size_t i = 0; i < this->basicCount; i++) {
+		freeRow(this->symbols[this->basic[i]].row);
+	}
+
+	free(this->basic);
+	free(this->symbols);
+
+	freeRow(this->objective);
+	freeRow(this->artificial);
+
+	free(this->constraints);
+	free(this->infeasible);
+
+	super(Object, self, dealloc);
+}
+
+#pragma mark - ConstraintSolver
+
+/**
+ * @fn SolverConstraint ConstraintSolver::addConstraint(ConstraintSolver *self, const SolverTerm *terms, size_t count, double constant, ConstraintRelation relation, double strength)
+ * @memberof ConstraintSolver
+ */
+static SolverConstraint addConstraint(ConstraintSolver *self, const SolverTerm *terms, size_t count, double constant, ConstraintRelation relation, double strength) {
+
+	assert(relation != ConstraintRelationNone);
+
+	ConstraintSolverTag tag = {
+		.strength = clamp(strength, 0.0, SOLVER_STRENGTH_REQUIRED)
+	};
+
+	Row *row = createRow(self, terms, count, constant, relation, &tag);
+
+	Symbol subject = chooseSubject(self, row, &tag);
+	if (subject == 0 && allDummies(self, row)) {
+		if (nearZero(row->constant)) {
+			subject = tag.marker;
+		} else {
+			MVC_LogWarn("Unsatisfiable constraint\n");
+			freeRow(row);
+
+			releaseSymbol(self, tag.marker);
+			if (tag.other) {
+				releaseSymbol(self, tag.other);
+			}
+			return 0;
+		}
+	}
+
+	if (subject) {
+		solveFor(row, subject);
+		substitute(self, subject, row);
+		setRow(self, subject, row);
+	} else {
+		const _Bool success = addWithArtificialVariable(self, row);
+		freeRow(row);
+
+		if (success == false) {
+			MVC_LogWarn("Unsatisfiable constraint\n");
+			return 0;
+		}
+	}
+
+	SolverConstraint constraint = self->freeConstraints;
+	if (constraint) {
+		self->freeConstraints = self->constraints[constraint].next;
+	} else {
+		if (self->constraintCount == self->constraintCapacity) {
+			self->constraintCapacity = self->constraintCapacity * 2;
+			self->constraints = realloc(self->constraints, self->constraintCapacity * sizeof(ConstraintSolverTag));
+			assert(self->constraints);
+		}
+
+		constraint = (SolverConstraint) self->constraintCount++;
+	}
+
+	self->constraints[constraint] = tag;
+
+	optimize(self, self->objective);
+
+	return constraint;
+}
+
+/**
+ * @fn void ConstraintSolver::addEditVariable(ConstraintSolver *self, SolverVariable variable, double strength)
+ * @memberof ConstraintSolver
+ */
+static void addEditVariable(ConstraintSolver *self, SolverVariable variable, double strength) {
+
+	assert(variable && variable < self->symbolCount);
+	assert(typeOf(self, variable) == SymbolTypeExternal);
+	assert(self->symbols[variable].edit == 0);
+	assert(strength < SOLVER_STRENGTH_REQUIRED);
+
+	const SolverTerm term = { .variable = variable, .coefficient = 1.0 };
+
+	const SolverConstraint edit = $(self, addConstraint, &term, 1, 0.0, ConstraintRelationEqual, strength);
+
+	self->symbols[variable].edit = edit;
+	self->symbols[variable].suggestion = 0.0;
+}
+
+/**
+ * @fn SolverVariable ConstraintSolver::createVariable(ConstraintSolver *self)
+ * @memberof ConstraintSolver
+ */
+static SolverVariable createVariable(ConstraintSolver *self) {
+	return createSymbol(self, SymbolTypeExternal);
+}
+
+/**
+ * @fn ConstraintSolver *ConstraintSolver::init(ConstraintSolver *self)
+ * @memberof ConstraintSolver
+ */
+static ConstraintSolver *init(ConstraintSolver *self) {
+
+	self = (ConstraintSolver *) super(Object, self, init);
+	if (self) {
+
+		self->objective = allocRow(0.0);
+
+		self->constraintCapacity = 16;
+		self->constraints = calloc(self->constraintCapacity, sizeof(ConstraintSolverTag));
+		assert(self->constraints);
+
+		self->constraintCount = 1;
+
+		createSymbol(self, SymbolTypeInvalid);
+	}
+
+	return self;
+}
+
+/**
+ * @fn void ConstraintSolver::removeConstraint(ConstraintSolver *self, SolverConstraint constraint)
+ * @memberof ConstraintSolver
+ */
+static void removeConstraint(ConstraintSolver *self, SolverConstraint constraint) {
+
+	assert(constraint && constraint < self->constraintCount);
+
+	const ConstraintSolverTag tag = self->constraints[constraint];
+	assert(tag.marker);
+
+	self->constraints[constraint] = (ConstraintSolverTag) {
+		.next = self->freeConstraints
+	};
+
+	self->freeConstraints = constraint;
+
+	if (typeOf(self, tag.marker) == SymbolTypeError) {
+		removeMarkerEffects(self, tag.marker, tag.strength);
+	}
+
+	if (tag.other && typeOf(self, tag.other) == SymbolTypeError) {
+		removeMarkerEffects(self, tag.other, tag.strength);
+	}
+
+	if (self->symbols[tag.marker].row == NULL) {
+
+		const Symbol leaving = markerLeavingSymbol(self, tag.marker);
+		if (leaving) {
+			pivot(self, leaving, tag.marker);
+		} else {
+			MVC_LogError("Failed to find leaving row\n");
+		}
+	}
+
+	if (self->symbols[tag.marker].row) {
+		freeRow(takeRow(self, tag.marker));
+	}
+
+	// the other symbol cancels wherever the marker is eliminated, so neither remains in the tableau
+	// beyond rounding error
+
+	releaseSymbol(self, tag.marker);
+
+	if (tag.other) {
+		releaseSymbol(self, tag.other);
+	}
+
+	optimize(self, self->objective);
+}
+
+/**
+ * @fn void ConstraintSolver::removeEditVariable(ConstraintSolver *self, SolverVariable variable)
+ * @memberof ConstraintSolver
+ */
+static void removeEditVariable(ConstraintSolver *self, SolverVariable variable) {
+
+	assert(variable && variable < self->symbolCount);
+
+	if (self->symbols[variable].edit) {
+		$(self, removeConstraint, self->symbols[variable].edit);
+		self->symbols[variable].edit = 0;
+	}
+}
+
+/**
+ * @fn void ConstraintSolver::removeVariable(ConstraintSolver *self, SolverVariable variable)
+ * @memberof ConstraintSolver
+ */
+static void removeVariable(ConstraintSolver *self, SolverVariable variable) {
+
+	assert(variable && variable < self->symbolCount);
+	assert(typeOf(self, variable) == SymbolTypeExternal);
+
+	$(self, removeEditVariable, variable);
+
+	if (self->symbols[variable].row) {
+		freeRow(takeRow(self, variable));
+	}
+
+	releaseSymbol(self, variable);
+}
+
+/**
+ * @fn void ConstraintSolver::suggestValue(ConstraintSolver *self, SolverVariable variable, double value)
+ * @memberof ConstraintSolver
+ */
+static void suggestValue(ConstraintSolver *self, SolverVariable variable, double value) {
+
+	assert(variable && variable < self->symbolCount);
+
+	ConstraintSolverSymbol *symbol = &self->symbols[variable];
+	assert(symbol->edit);
+
+	const double delta = value - symbol->suggestion;
+	if (delta == 0.0) {
+		return;
+	}
+
+	symbol->suggestion = value;
+
+	const ConstraintSolverTag *tag = &self->constraints[symbol->edit];
+
+	Row *row = self->symbols[tag->marker].row;
+	if (row) {
+		row->constant -= delta;
+		if (row->constant < 0.0) {
+			markInfeasible(self, tag->marker);
+		}
+	} else if ((row = self->symbols[tag->other].row)) {
+		row->constant += delta;
+		if (row->constant < 0.0) {
+			markInfeasible(self, tag->other);
+		}
+	} else {
+		for (size_t i = 0; i < self->basicCount; i++) {
+
+			const Symbol s = self->basic[i];
+			row = self->symbols[s].row;
+
+			const double coefficient = coefficientFor(row, tag->marker);
+			if (coefficient != 0.0) {
+				row->constant += delta * coefficient;
+				if (row->constant < 0.0 && typeOf(self, s) != SymbolTypeExternal) {
+					markInfeasible(self, s);
+				}
+			}
+		}
+	}
+
+	dualOptimize(self);
+}
+
+/**
+ * @fn double ConstraintSolver::valueOfVariable(const ConstraintSolver *self, SolverVariable variable)
+ * @memberof ConstraintSolver
+ */
+static double valueOfVariable(const ConstraintSolver *self, SolverVariable variable) {
+
+	assert(variable && variable < self->symbolCount);
+
+	const Row *row = self->symbols[variable].row;
+	return row ? row->constant : 0.0;
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	((ObjectInterface *) clazz->def->interface)->dealloc = dealloc;
+
+	((ConstraintSolverInterface *) clazz->def->interface)->addConstraint = addConstraint;
+	((ConstraintSolverInterface *) clazz->def->interface)->addEditVariable = addEditVariable;
+	((ConstraintSolverInterface *) clazz->def->interface)->createVariable = createVariable;
+	((ConstraintSolverInterface *) clazz->def->interface)->init = init;
+	((ConstraintSolverInterface *) clazz->def->interface)->removeConstraint = removeConstraint;
+	((ConstraintSolverInterface *) clazz->def->interface)->removeEditVariable = removeEditVariable;
+	((ConstraintSolverInterface *) clazz->def->interface)->removeVariable = removeVariable;
+	((ConstraintSolverInterface *) clazz->def->interface)->suggestValue = suggestValue;
+	((ConstraintSolverInterface *) clazz->def->interface)->valueOfVariable = valueOfVariable;
+}
+
+/**
+ * @fn Class *ConstraintSolver::_ConstraintSolver(void)
+ * @memberof ConstraintSolver
+ */
+Class *_ConstraintSolver(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "ConstraintSolver";
+		clazz.superclass = _Object();
+		clazz.instanceSize = sizeof(ConstraintSolver);
+		clazz.interfaceOffset = offsetof(ConstraintSolver, interface);
+		clazz.interfaceSize = sizeof(ConstraintSolverInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
@@ -0,0 +1,275 @@
+/*
+ * ObjectivelyMVC: MVC framework for OpenGL and SDL2 in c.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Object.h>
+
+#include <ObjectivelyMVC/Constraint.h>
+
+/**
+ * @file
+ * @brief An incremental solver for systems of linear Constraints.
+ */
+
+#define SOLVER_STRENGTH_REQUIRED 1001001000.0
+#define SOLVER_STRENGTH_STRONG   1000000.0
+#define SOLVER_STRENGTH_MEDIUM   1000.0
+#define SOLVER_STRENGTH_WEAK     1.0
+
+/**
+ * @brief A handle to a constraint added to a ConstraintSolver, or 0.
+ */
+typedef unsigned int SolverConstraint;
+
+/**
+ * @brief A handle to a variable of a ConstraintSolver, or 0.
+ */
+typedef unsigned int SolverVariable;
+
+/**
+ * @brief A term of a linear expression.
+ */
+typedef struct {
+
+	/**
+	 * @brief The variable.
+	 */
+	SolverVariable variable;
+
+	/**
+	 * @brief The coefficient.
+	 */
+	double coefficient;
+} SolverTerm;
+
+typedef struct ConstraintSolverRow ConstraintSolverRow;
+typedef struct ConstraintSolverSymbol ConstraintSolverSymbol;
+typedef struct ConstraintSolverTag ConstraintSolverTag;
+
+typedef struct ConstraintSolver ConstraintSolver;
+typedef struct ConstraintSolverInterface ConstraintSolverInterface;
+
+/**
+ * @brief The ConstraintSolver type.
+ * @details ConstraintSolver implements the Cassowary algorithm: constraints are maintained in a
+ * simplex tableau, so that adding or removing a constraint, or suggesting a new value for an edit
+ * variable, re-optimizes only the rows affected by that change.
+ *
+ * Constraints weaker than ::SOLVER_STRENGTH_REQUIRED may be violated, with the error of each
+ * weighted by its strength. Edit variables are suggested values which other constraints may
+ * override, and are typically used to hold variables at their current values.
+ * @extends Object
+ */
+struct ConstraintSolver {
+
+	/**
+	 * @brief The superclass.
+	 */
+	Object object;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	ConstraintSolverInterface *interface;
+
+	/**
+	 * @brief The artificial objective, while adding a required constraint.
+	 * @private
+	 */
+	ConstraintSolverRow *artificial;
+
+	/**
+	 * @brief The basic symbols, i.e. those for which the tableau holds a row.
+	 * @private
+	 */
+	unsigned int *basic;
+
+	/**
+	 * @brief The count and capacity of `basic`.
+	 * @private
+	 */
+	size_t basicCount, basicCapacity;
+
+	/**
+	 * @brief The constraints, indexed by SolverConstraint.
+	 * @private
+	 */
+	ConstraintSolverTag *constraints;
+
+	/**
+	 * @brief The count and capacity of `constraints`.
+	 * @private
+	 */
+	size_t constraintCount, constraintCapacity;
+
+	/**
+	 * @brief The first of the removed constraints, linked for reuse, or 0.
+	 * @private
+	 */
+	SolverConstraint freeConstraints;
+
+	/**
+	 * @brief The first of the released symbols, linked for reuse, or 0.
+	 * @private
+	 */
+	unsigned int freeSymbols;
+
+	/**
+	 * @brief The rows made infeasible by an edit, pending dual optimization.
+	 * @private
+	 */
+	unsigned int *infeasible;
+
+	/**
+	 * @brief The count and capacity of `infeasible`.
+	 * @private
+	 */
+	size_t infeasibleCount, infeasibleCapacity;
+
+	/**
+	 * @brief The objective.
+	 * @private
+	 */
+	ConstraintSolverRow *objective;
+
+	/**
+	 * @brief The symbols of the tableau, including variables, indexed by id.
+	 * @private
+	 */
+	ConstraintSolverSymbol *symbols;
+
+	/**
+	 * @brief The count and capacity of `symbols`.
+	 * @private
+	 */
+	size_t symbolCount, symbolCapacity;
+};
+
+/**
+ * @brief The ConstraintSolver interface.
+ */
+struct ConstraintSolverInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn SolverConstraint ConstraintSolver::addConstraint(ConstraintSolver *self, const SolverTerm *terms, size_t count, double constant, ConstraintRelation relation, double strength)
+	 * @brief Adds the constraint `terms + constant <relation> 0`.
+	 * @param self The ConstraintSolver.
+	 * @param terms The terms of the linear expression.
+	 * @param count The count of `terms`.
+	 * @param constant The constant of the linear expression.
+	 * @param relation The relation. Strict inequalities are treated as inclusive.
+	 * @param strength The strength, up to ::SOLVER_STRENGTH_REQUIRED.
+	 * @return The constraint, or 0 if it is required and can not be satisfied.
+	 * @memberof ConstraintSolver
+	 */
+	SolverConstraint (*addConstraint)(ConstraintSolver *self, const SolverTerm *terms, size_t count, double constant, ConstraintRelation relation, double strength);
+
+	/**
+	 * @fn void ConstraintSolver::addEditVariable(ConstraintSolver *self, SolverVariable variable, double strength)
+	 * @brief Adds an edit constraint for `variable`, so that values may be suggested for it.
+	 * @param self The ConstraintSolver.
+	 * @param variable The variable.
+	 * @param strength The strength, which must be weaker than ::SOLVER_STRENGTH_REQUIRED.
+	 * @memberof ConstraintSolver
+	 */
+	void (*addEditVariable)(ConstraintSolver *self, SolverVariable variable, double strength);
+
+	/**
+	 * @fn SolverVariable ConstraintSolver::createVariable(ConstraintSolver *self)
+	 * @param self The ConstraintSolver.
+	 * @return A new variable, with a value of 0.
+	 * @memberof ConstraintSolver
+	 */
+	SolverVariable (*createVariable)(ConstraintSolver *self);
+
+	/**
+	 * @fn ConstraintSolver *ConstraintSolver::init(ConstraintSolver *self)
+	 * @brief Initializes this ConstraintSolver.
+	 * @param self The ConstraintSolver.
+	 * @return The initialized ConstraintSolver, or `NULL` on error.
+	 * @memberof ConstraintSolver
+	 */
+	ConstraintSolver *(*init)(ConstraintSolver *self);
+
+	/**
+	 * @fn void ConstraintSolver::removeConstraint(ConstraintSolver *self, SolverConstraint constraint)
+	 * @brief Removes the specified constraint.
+	 * @param self The ConstraintSolver.
+	 * @param constraint The constraint.
+	 * @memberof ConstraintSolver
+	 */
+	void (*removeConstraint)(ConstraintSolver *self, SolverConstraint constraint);
+
+	/**
+	 * @fn void ConstraintSolver::removeEditVariable(ConstraintSolver *self, SolverVariable variable)
+	 * @brief Removes the edit constraint for `variable`, if any.
+	 * @param self The ConstraintSolver.
+	 * @param variable The variable.
+	 * @memberof ConstraintSolver
+	 */
+	void (*removeEditVariable)(ConstraintSolver *self, SolverVariable variable);
+
+	/**
+	 * @fn void ConstraintSolver::removeVariable(ConstraintSolver *self, SolverVariable variable)
+	 * @brief Removes `variable`, so that it may be reused by a subsequent call to `createVariable`.
+	 * @param self The ConstraintSolver.
+	 * @param variable The variable, which must no longer be referenced by any constraint.
+	 * @memberof ConstraintSolver
+	 */
+	void (*removeVariable)(ConstraintSolver *self, SolverVariable variable);
+
+	/**
+	 * @fn void ConstraintSolver::suggestValue(ConstraintSolver *self, SolverVariable variable, double value)
+	 * @brief Suggests a value for the edit variable `variable`, and re-solves.
+	 * @param self The ConstraintSolver.
+	 * @param variable The edit variable.
+	 * @param value The suggested value.
+	 * @remarks Suggesting the value most recently suggested is a no-op.
+	 * @memberof ConstraintSolver
+	 */
+	void (*suggestValue)(ConstraintSolver *self, SolverVariable variable, double value);
+
+	/**
+	 * @fn double ConstraintSolver::valueOfVariable(const ConstraintSolver *self, SolverVariable variable)
+	 * @param self The ConstraintSolver.
+	 * @param variable The variable.
+	 * @return The current solution for `variable`.
+	 * @memberof ConstraintSolver
+	 */
+	double (*valueOfVariable)(const ConstraintSolver *self, SolverVariable variable);
+};
+
+/**
+ * @fn Class *ConstraintSolver::_ConstraintSolver(void)
+ * @brief The ConstraintSolver archetype.
+ * @return The ConstraintSolver Class.
+ * @memberof ConstraintSolver
+ */
+OBJECTIVELYMVC_EXPORT Class *_ConstraintSolver(void);
@@ -202,6 +202,10 @@ static void respondToEvent(View *self, const SDL_Event *event) {
 		$(this, stateDidChange);
 	}
 
+	if (didCaptureEvent || this->state != state) {
+		$(self, setNeedsDisplay);
+	}
+
 	if (didCaptureEvent) {
 		return;
 	}
@@ -0,0 +1,537 @@
+/*
+ * ObjectivelyMVC: MVC framework for OpenGL and SDL2 in c.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include <ObjectivelyMVC/CoreRenderer.h>
+#include <ObjectivelyMVC/Log.h>
+
+/**
+ * @brief The OpenGL 3.3 entry points, resolved via SDL_GL_GetProcAddress.
+ */
+static struct {
+	PFNGLATTACHSHADERPROC AttachShader;
+	PFNGLBINDBUFFERPROC BindBuffer;
+	PFNGLBINDVERTEXARRAYPROC BindVertexArray;
+	PFNGLBUFFERDATAPROC BufferData;
+	PFNGLCOMPILESHADERPROC CompileShader;
+	PFNGLCREATEPROGRAMPROC CreateProgram;
+	PFNGLCREATESHADERPROC CreateShader;
+	PFNGLDELETEBUFFERSPROC DeleteBuffers;
+	PFNGLDELETEPROGRAMPROC DeleteProgram;
+	PFNGLDELETESHADERPROC DeleteShader;
+	PFNGLDELETEVERTEXARRAYSPROC DeleteVertexArrays;
+	PFNGLENABLEVERTEXATTRIBARRAYPROC EnableVertexAttribArray;
+	PFNGLGENBUFFERSPROC GenBuffers;
+	PFNGLGENVERTEXARRAYSPROC GenVertexArrays;
+	PFNGLGETPROGRAMINFOLOGPROC GetProgramInfoLog;
+	PFNGLGETPROGRAMIVPROC GetProgramiv;
+	PFNGLGETSHADERINFOLOGPROC GetShaderInfoLog;
+	PFNGLGETSHADERIVPROC GetShaderiv;
+	PFNGLGETUNIFORMLOCATIONPROC GetUniformLocation;
+	PFNGLLINKPROGRAMPROC LinkProgram;
+	PFNGLSHADERSOURCEPROC ShaderSource;
+	PFNGLUNIFORM1IPROC Uniform1i;
+	PFNGLUNIFORMMATRIX4FVPROC UniformMatrix4fv;
+	PFNGLUSEPROGRAMPROC UseProgram;
+	PFNGLVERTEXATTRIBPOINTERPROC VertexAttribPointer;
+} gl;
+
+#define GetProcAddress(name) (gl.name = SDL_GL_GetProcAddress("gl" #name))
+
+static const char *vertexShader =
+	"#version 330 core\n"
+	"layout (location = 0) in vec2 position;\n"
+	"layout (location = 1) in vec2 texcoord;\n"
+	"layout (location = 2) in vec4 color;\n"
+	"uniform mat4 projection;\n"
+	"out vec2 st;\n"
+	"out vec4 rgba;\n"
+	"void main() {\n"
+	"	st = texcoord;\n"
+	"	rgba = color;\n"
+	"	gl_Position = projection * vec4(position, 0.0, 1.0);\n"
+	"}\n";
+
+static const char *fragmentShader =
+	"#version 330 core\n"
+	"uniform sampler2D sampler;\n"
+	"uniform bool textured;\n"
+	"in vec2 st;\n"
+	"in vec4 rgba;\n"
+	"out vec4 fragColor;\n"
+	"void main() {\n"
+	"	fragColor = textured ? rgba * texture(sampler, st) : rgba;\n"
+	"}\n";
+
+#define _Class _CoreRenderer
+
+#pragma mark - Object
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	CoreRenderer *this = (CoreRenderer *) self;
+
+	if (this->program) {
+		gl.DeleteProgram(this->program);
+		gl.DeleteBuffers(1, &this->elementBuffer);
+		gl.DeleteBuffers(1, &this->vertexBuffer);
+		gl.DeleteVertexArrays(1, &this->vertexArray);
+	}
+
+	super(Object, self, dealloc);
+}
+
+#pragma mark - Renderer
+
+/**
+ * @brief Resolves the OpenGL 3.3 entry points for the current context.
+ * @return True if all entry points were resolved, false otherwise.
+ */
+static _Bool getProcAddresses(void) {
+
+	return GetProcAddress(AttachShader)
+		&& GetProcAddress(BindBuffer)
+		&& GetProcAddress(BindVertexArray)
+		&& GetProcAddress(BufferData)
+		&& GetProcAddress(CompileShader)
+		&& GetProcAddress(CreateProgram)
+		&& GetProcAddress(CreateShader)
+		&& GetProcAddress(DeleteBuffers)
+		&& GetProcAddress(DeleteProgram)
+		&& GetProcAddress(DeleteShader)
+		&& GetProcAddress(DeleteVertexArrays)
+		&& GetProcAddress(EnableVertexAttribArray)
+		&& GetProcAddress(GenBuffers)
+		&& GetProcAddress(GenVertexArrays)
+		&& GetProcAddress(GetProgramInfoLog)
+		&& GetProcAddress(GetProgramiv)
+		&& GetProcAddress(GetShaderInfoLog)
+		&& GetProcAddress(GetShaderiv)
+		&& GetProcAddress(GetUniformLocation)
+		&& GetProcAddress(LinkProgram)
+		&& GetProcAddress(ShaderSource)
+		&& GetProcAddress(Uniform1i)
+		&& GetProcAddress(UniformMatrix4fv)
+		&& GetProcAddress(UseProgram)
+		&& GetProcAddress(VertexAttribPointer);
+}
+
+/**
+ * @brief Compiles a shader of the given type from the given source.
+ * @return The shader name, or `0` on error.
+ */
+static GLuint compileShader(GLenum type, const char *source) {
+
+	const GLuint shader = gl.CreateShader(type);
+
+	gl.ShaderSource(shader, 1, &source, NULL);
+	gl.CompileShader(shader);
+
+	GLint status;
+	gl.GetShaderiv(shader, GL_COMPILE_STATUS, &status);
+
+	if (status == GL_FALSE) {
+		char log[1024];
+		gl.GetShaderInfoLog(shader, sizeof(log), NULL, log);
+
+		MVC_LogError("Failed to compile shader: %s\n", log);
+
+		gl.DeleteShader(shader);
+		return 0;
+	}
+
+	return shader;
+}
+
+/**
+ * @brief Creates the shader program, vertex array and buffers.
+ * @return True on success, false otherwise.
+ */
+static _Bool createObjects(CoreRenderer *self) {
+
+	if (getProcAddresses() == false) {
+		MVC_LogError("OpenGL 3.3 is not available\n");
+		return false;
+	}
+
+	const GLuint vs = compileShader(GL_VERTEX_SHADER, vertexShader);
+	const GLuint fs = compileShader(GL_FRAGMENT_SHADER, fragmentShader);
+
+	if (vs && fs) {
+		self->program = gl.CreateProgram();
+
+		gl.AttachShader(self->program, vs);
+		gl.AttachShader(self->program, fs);
+
+		gl.LinkProgram(self->program);
+	}
+
+	gl.DeleteShader(vs);
+	gl.DeleteShader(fs);
+
+	if (self->program == 0) {
+		return false;
+	}
+
+	GLint status;
+	gl.GetProgramiv(self->program, GL_LINK_STATUS, &status);
+
+	if (status == GL_FALSE) {
+		char log[1024];
+		gl.GetProgramInfoLog(self->program, sizeof(log), NULL, log);
+
+		MVC_LogError("Failed to link program: %s\n", log);
+
+		gl.DeleteProgram(self->program);
+		self->program = 0;
+		return false;
+	}
+
+	self->uniforms.projection = gl.GetUniformLocation(self->program, "projection");
+	self->uniforms.sampler = gl.GetUniformLocation(self->program, "sampler");
+	self->uniforms.textured = gl.GetUniformLocation(self->program, "textured");
+
+	gl.UseProgram(self->program);
+	gl.Uniform1i(self->uniforms.sampler, 0);
+
+	self->projectionSize = MakeSize(0, 0);
+
+	gl.GenVertexArrays(1, &self->vertexArray);
+	gl.BindVertexArray(self->vertexArray);
+
+	gl.GenBuffers(1, &self->vertexBuffer);
+	gl.BindBuffer(GL_ARRAY_BUFFER, self->vertexBuffer);
+
+	gl.GenBuffers(1, &self->elementBuffer);
+	gl.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, self->elementBuffer);
+
+	self->elementCapacity = 0;
+
+	const GLsizei stride = sizeof(RendererVertex);
+
+	gl.EnableVertexAttribArray(0);
+	gl.VertexAttribPointer(0, 2, GL_INT, GL_FALSE, stride, (GLvoid *) offsetof(RendererVertex, x));
+
+	gl.EnableVertexAttribArray(1);
+	gl.VertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride, (GLvoid *) offsetof(RendererVertex, s));
+
+	gl.EnableVertexAttribArray(2);
+	gl.VertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, (GLvoid *) offsetof(RendererVertex, color));
+
+	gl.BindVertexArray(0);
+
+	return true;
+}
+
+/**
+ * @brief Grows the element buffer so that it indexes at least `count` quads as triangle pairs.
+ * @remarks The vertex array object must be bound.
+ */
+static void reserveElements(CoreRenderer *self, size_t count) {
+
+	if (count <= self->elementCapacity) {
+		return;
+	}
+
+	size_t capacity = self->elementCapacity ?: 256;
+	while (capacity < count) {
+		capacity *= 2;
+	}
+
+	GLuint *elements = malloc(capacity * 6 * sizeof(GLuint));
+	assert(elements);
+
+	for (size_t i = 0; i < capacity; i++) {
+		const GLuint v = (GLuint) i * 4;
+
+		elements[i * 6 + 0] = v + 0;
+		elements[i * 6 + 1] = v + 1;
+		elements[i * 6 + 2] = v + 2;
+		elements[i * 6 + 3] = v + 0;
+		elements[i * 6 + 4] = v + 2;
+		elements[i * 6 + 5] = v + 3;
+	}
+
+	gl.BufferData(GL_ELEMENT_ARRAY_BUFFER, capacity * 6 * sizeof(GLuint), elements, GL_STATIC_DRAW);
+
+	free(elements);
+
+	self->elementCapacity = capacity;
+}
+
+/**
+ * @see Renderer::beginFrame(Renderer *)
+ */
+static void beginFrame(Renderer *self) {
+
+	CoreRenderer *this = (CoreRenderer *) self;
+
+	if (this->program == 0) {
+		if (createObjects(this) == false) {
+			return;
+		}
+	}
+
+	gl.UseProgram(this->program);
+	gl.BindVertexArray(this->vertexArray);
+	gl.BindBuffer(GL_ARRAY_BUFFER, this->vertexBuffer);
+
+	this->textured = -1;
+
+	super(Renderer, self, beginFrame);
+
+	const SDL_Size size = self->metrics.size;
+	if (size.w != this->projectionSize.w || size.h != this->projectionSize.h) {
+
+		const GLfloat projection[] = {
+			2.0 / size.w, 0.0, 0.0, 0.0,
+			0.0, -2.0 / size.h, 0.0, 0.0,
+			0.0, 0.0, -1.0, 0.0,
+			-1.0, 1.0, 0.0, 1.0
+		};
+
+		gl.UniformMatrix4fv(this->uniforms.projection, 1, GL_FALSE, projection);
+		this->projectionSize = size;
+	}
+}
+
+/**
+ * @see Renderer::createTexture(const Renderer *, const SDL_Surface *)
+ */
+static GLuint createTexture(const Renderer *self, const SDL_Surface *surface) {
+
+	assert(surface);
+
+	GLenum format, internalFormat;
+	switch (surface->format->BytesPerPixel) {
+		case 1:
+			format = GL_RED;
+			internalFormat = GL_R8;
+			break;
+		case 3:
+			format = GL_RGB;
+			internalFormat = GL_RGB8;
+			break;
+		case 4:
+			format = GL_RGBA;
+			internalFormat = GL_RGBA8;
+			break;
+		default:
+			MVC_LogError("Invalid surface format: %s\n", SDL_GetPixelFormatName(surface->format->format));
+			return 0;
+	}
+
+	GLuint texture;
+	glGenTextures(1, &texture);
+
+	glBindTexture(GL_TEXTURE_2D, texture);
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+	if (format == GL_RED) {
+		const GLint swizzle[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+		glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+	}
+
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+	glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, surface->w, surface->h, 0, format, GL_UNSIGNED_BYTE, surface->pixels);
+
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+	glBindTexture(GL_TEXTURE_2D, self->state.texture);
+
+	((Renderer *) self)->stats.textureUploads++;
+
+	return texture;
+}
+
+/**
+ * @see Renderer::endFrame(Renderer *)
+ */
+static void endFrame(Renderer *self) {
+
+	CoreRenderer *this = (CoreRenderer *) self;
+
+	super(Renderer, self, endFrame);
+
+	if (this->program) {
+		gl.BindVertexArray(0);
+		gl.UseProgram(0);
+	}
+}
+
+/**
+ * @see Renderer::flush(Renderer *)
+ */
+static void flush(Renderer *self) {
+
+	CoreRenderer *this = (CoreRenderer *) self;
+
+	RendererBatch *batch = &self->batch;
+
+	if (batch->count == 0) {
+		return;
+	}
+
+	if (this->program == 0) {
+		batch->count = 0;
+		return;
+	}
+
+	gl.BufferData(GL_ARRAY_BUFFER, batch->count * sizeof(RendererVertex), batch->vertices, GL_STREAM_DRAW);
+
+	if (batch->texture && batch->texture != self->state.texture) {
+		glBindTexture(GL_TEXTURE_2D, batch->texture);
+		self->state.texture = batch->texture;
+	}
+
+	const GLint textured = batch->texture != 0;
+	if (textured != this->textured) {
+		gl.Uniform1i(this->uniforms.textured, textured);
+		this->textured = textured;
+	}
+
+	if (batch->mode == GL_QUADS) {
+		const size_t quads = batch->count / 4;
+
+		reserveElements(this, quads);
+
+		glDrawElements(GL_TRIANGLES, (GLsizei) (quads * 6), GL_UNSIGNED_INT, NULL);
+	} else {
+		glDrawArrays(batch->mode, 0, (GLsizei) batch->count);
+	}
+
+	self->stats.drawCalls++;
+	self->stats.vertices += batch->count;
+
+	batch->count = 0;
+}
+
+/**
+ * @see Renderer::renderDeviceDidReset(Renderer *)
+ */
+static void renderDeviceDidReset(Renderer *self) {
+
+	super(Renderer, self, renderDeviceDidReset);
+
+	CoreRenderer *this = (CoreRenderer *) self;
+
+	this->elementBuffer = 0;
+	this->elementCapacity = 0;
+	this->program = 0;
+	this->vertexArray = 0;
+	this->vertexBuffer = 0;
+}
+
+/**
+ * @see Renderer::updateTexture(Renderer *, GLuint, const SDL_Surface *, const SDL_Rect *)
+ */
+static void updateTexture(Renderer *self, GLuint texture, const SDL_Surface *surface, const SDL_Rect *rect) {
+
+	assert(surface);
+	assert(rect);
+
+	if (surface->format->BytesPerPixel != 1) {
+		super(Renderer, self, updateTexture, texture, surface, rect);
+		return;
+	}
+
+	$(self, flush);
+
+	const Uint8 *pixels = (Uint8 *) surface->pixels + rect->y * surface->pitch + rect->x;
+
+	glBindTexture(GL_TEXTURE_2D, texture);
+
+	GLint alignment, rowLength;
+	glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+	glGetIntegerv(GL_UNPACK_ROW_LENGTH, &rowLength);
+
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, surface->pitch);
+
+	glTexSubImage2D(GL_TEXTURE_2D, 0, rect->x, rect->y, rect->w, rect->h, GL_RED, GL_UNSIGNED_BYTE, pixels);
+
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, rowLength);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+
+	glBindTexture(GL_TEXTURE_2D, self->state.texture);
+}
+
+#pragma mark - CoreRenderer
+
+/**
+ * @fn CoreRenderer *CoreRenderer::init(CoreRenderer *self)
+ * @memberof CoreRenderer
+ */
+static CoreRenderer *init(CoreRenderer *self) {
+	return (CoreRenderer *) super(Renderer, self, init);
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	((ObjectInterface *) clazz->def->interface)->dealloc = dealloc;
+
+	((RendererInterface *) clazz->def->interface)->beginFrame = beginFrame;
+	((RendererInterface *) clazz->def->interface)->createTexture = createTexture;
+	((RendererInterface *) clazz->def->interface)->endFrame = endFrame;
+	((RendererInterface *) clazz->def->interface)->flush = flush;
+	((RendererInterface *) clazz->def->interface)->renderDeviceDidReset = renderDeviceDidReset;
+	((RendererInterface *) clazz->def->interface)->updateTexture = updateTexture;
+
+	((CoreRendererInterface *) clazz->def->interface)->init = init;
+}
+
+/**
+ * @fn Class *CoreRenderer::_CoreRenderer(void)
+ * @memberof CoreRenderer
+ */
+Class *_CoreRenderer(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "CoreRenderer";
+		clazz.superclass = _Renderer();
+		clazz.instanceSize = sizeof(CoreRenderer);
+		clazz.interfaceOffset = offsetof(CoreRenderer, interface);
+		clazz.interfaceSize = sizeof(CoreRendererInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
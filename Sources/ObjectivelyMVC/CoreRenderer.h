@@ -0,0 +1,140 @@
+/*
+ * ObjectivelyMVC: MVC framework for OpenGL and SDL2 in c.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+
+#pragma once
+
+#include <ObjectivelyMVC/Renderer.h>
+
+/**
+ * @file
+ * @brief An OpenGL 3.3 core profile Renderer.
+ */
+
+typedef struct CoreRenderer CoreRenderer;
+typedef struct CoreRendererInterface CoreRendererInterface;
+
+/**
+ * @brief An OpenGL 3.3 core profile Renderer.
+ * @details Primitives are batched exactly as they are by Renderer, but are submitted through a
+ * vertex array object and a streamed vertex buffer, and shaded by a single shader program. Quads
+ * are drawn as indexed triangles. No fixed-function or compatibility profile entry points are
+ * used, so this Renderer may be used within core profile contexts.
+ * @remarks WindowController::initWithWindow selects this Renderer automatically when the window's
+ * OpenGL context uses the core profile. It may also be set via WindowController::setRenderer.
+ * @extends Renderer
+ */
+struct CoreRenderer {
+
+	/**
+	 * @brief The superclass.
+	 */
+	Renderer renderer;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	CoreRendererInterface *interface;
+
+	/**
+	 * @brief The element buffer of quad indices.
+	 * @private
+	 */
+	GLuint elementBuffer;
+
+	/**
+	 * @brief The count of quads `elementBuffer` can index.
+	 * @private
+	 */
+	size_t elementCapacity;
+
+	/**
+	 * @brief The shader program.
+	 * @private
+	 */
+	GLuint program;
+
+	/**
+	 * @brief The window size for which the projection uniform was last set.
+	 * @private
+	 */
+	SDL_Size projectionSize;
+
+	/**
+	 * @brief The shader program's uniform locations.
+	 * @private
+	 */
+	struct {
+		GLint projection;
+		GLint sampler;
+		GLint textured;
+	} uniforms;
+
+	/**
+	 * @brief The last value of the `textured` uniform, or `-1` if unknown.
+	 * @private
+	 */
+	GLint textured;
+
+	/**
+	 * @brief The vertex array object.
+	 * @private
+	 */
+	GLuint vertexArray;
+
+	/**
+	 * @brief The vertex buffer.
+	 * @private
+	 */
+	GLuint vertexBuffer;
+};
+
+/**
+ * @brief The CoreRenderer interface.
+ */
+struct CoreRendererInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	RendererInterface rendererInterface;
+
+	/**
+	 * @fn CoreRenderer *CoreRenderer::init(CoreRenderer *self)
+	 * @brief Initializes this CoreRenderer.
+	 * @param self The CoreRenderer.
+	 * @return The initialized CoreRenderer, or `NULL` on error.
+	 * @remarks OpenGL objects are created lazily, on the first call to Renderer::beginFrame.
+	 * @memberof CoreRenderer
+	 */
+	CoreRenderer *(*init)(CoreRenderer *self);
+};
+
+/**
+ * @fn Class *CoreRenderer::_CoreRenderer(void)
+ * @brief The CoreRenderer archetype.
+ * @return The CoreRenderer Class.
+ * @memberof CoreRenderer
+ */
+OBJECTIVELYMVC_EXPORT Class *_CoreRenderer(void);
@@ -27,15 +27,57 @@
 #include <fontconfig/fontconfig.h>
 
 #include <Objectively/MutableArray.h>
+#include <Objectively/MutableDictionary.h>
 #include <Objectively/String.h>
 
+#include <ObjectivelyMVC/Colors.h>
 #include <ObjectivelyMVC/Font.h>
 #include <ObjectivelyMVC/Log.h>
 #include <ObjectivelyMVC/View.h>
 #include <ObjectivelyMVC/Window.h>
 
+#define FONT_ATLAS_SIZE 256
+
 #define _Class _Font
 
+/**
+ * @brief Shared Fonts, keyed by their resolved file, size and index.
+ */
+static MutableDictionary *_fonts;
+
+/**
+ * @brief Keys of `_fonts`, keyed by the descriptor they were requested with. This memoizes
+ * Fontconfig pattern matching.
+ */
+static MutableDictionary *_fontsByDescriptor;
+
+/**
+ * @brief Font file contents, keyed by path.
+ */
+static MutableDictionary *_fontData;
+
+/**
+ * @brief Frees the glyphs and surface of the given FontAtlas.
+ */
+static void freeAtlas(FontAtlas *atlas) {
+
+	for (size_t i = 0; i < lengthof(atlas->glyphs); i++) {
+		free(atlas->glyphs[i]);
+	}
+
+	SDL_FreeSurface(atlas->surface);
+
+	if (atlas->texture) {
+		$(atlas->renderer, deleteTexture, atlas->texture);
+	}
+
+	if (atlas->renderer) {
+		release(atlas->renderer);
+	}
+
+	memset(atlas, 0, sizeof(*atlas));
+}
+
 #pragma mark - Object
 
 /**
@@ -45,6 +87,8 @@ static void dealloc(Object *self) {
 
 	Font *this = (Font *) self;
 
+	freeAtlas(&this->atlas);
+
 	release(this->data);
 	
 	TTF_CloseFont(this->font);
@@ -109,19 +153,19 @@ static Font *defaultFont(FontCategory category) {
 			case FontCategoryDefault:
 			case FontCategoryPrimaryLabel:
 			case FontCategoryPrimaryControl:
-				_defaultFonts[category] = $(alloc(Font), initWithAttributes, DEFAULT_FONT_FAMILY, 16, 0);
+				_defaultFonts[category] = $$(Font, fontWithAttributes, DEFAULT_FONT_FAMILY, 16, 0);
 				break;
 			case FontCategorySecondaryLabel:
 			case FontCategorySecondaryControl:
-				_defaultFonts[category] = $(alloc(Font), initWithAttributes, DEFAULT_FONT_FAMILY, 14, 0);
+				_defaultFonts[category] = $$(Font, fontWithAttributes, DEFAULT_FONT_FAMILY, 14, 0);
 				break;
 			case FontCategoryPrimaryResponder:
 			case FontCategorySecondaryResponder:
-				_defaultFonts[category] = $(alloc(Font), initWithAttributes, DEFAULT_FONT_FAMILY, 18, 0);
+				_defaultFonts[category] = $$(Font, fontWithAttributes, DEFAULT_FONT_FAMILY, 18, 0);
 				break;
 			default:
 				MVC_LogWarn("No Font set for user category %d\n", category);
-				_defaultFonts[category] = $(alloc(Font), initWithAttributes, DEFAULT_FONT_FAMILY, 16, 0);
+				_defaultFonts[category] = $$(Font, fontWithAttributes, DEFAULT_FONT_FAMILY, 16, 0);
 				break;
 		}
 	}
@@ -131,11 +175,313 @@ static Font *defaultFont(FontCategory category) {
 }
 
 /**
- * @fn Font *Font::initWithAttributes(Font *self, const char *family, int size, int style)
+ * @brief Decodes the UTF-8 sequence at `chars` into `c`.
+ * @return The length of the sequence, in bytes.
+ * @remarks Characters outside of the Basic Multilingual Plane, which SDL_ttf can not render as
+ * individual glyphs, are decoded as `?`.
+ */
+static size_t decodeCharacter(const char *chars, Uint16 *c) {
+
+	const unsigned char *s = (const unsigned char *) chars;
+
+	if (s[0] < 0x80) {
+		*c = s[0];
+		return 1;
+	} else if ((s[0] & 0xe0) == 0xc0 && (s[1] & 0xc0) == 0x80) {
+		*c = ((s[0] & 0x1f) << 6) | (s[1] & 0x3f);
+		return 2;
+	} else if ((s[0] & 0xf0) == 0xe0 && (s[1] & 0xc0) == 0x80 && (s[2] & 0xc0) == 0x80) {
+		*c = ((s[0] & 0x0f) << 12) | ((s[1] & 0x3f) << 6) | (s[2] & 0x3f);
+		return 3;
+	} else if ((s[0] & 0xf8) == 0xf0 && (s[1] & 0xc0) == 0x80 && (s[2] & 0xc0) == 0x80 && (s[3] & 0xc0) == 0x80) {
+		*c = '?';
+		return 4;
+	}
+
+	*c = '?';
+	return 1;
+}
+
+/**
+ * @brief Grows the atlas surface of the given Font to at least the specified size.
+ * @return True if the atlas is at least the specified size, false if it would exceed the maximum
+ * texture size of the given Renderer.
+ */
+static _Bool growAtlas(Font *self, const Renderer *renderer, int w, int h) {
+
+	FontAtlas *atlas = &self->atlas;
+
+	int width = atlas->surface ? atlas->surface->w : FONT_ATLAS_SIZE;
+	int height = atlas->surface ? atlas->surface->h : FONT_ATLAS_SIZE;
+
+	while (width < w) {
+		width *= 2;
+	}
+
+	while (height < h) {
+		height *= 2;
+	}
+
+	if (atlas->surface && atlas->surface->w == width && atlas->surface->h == height) {
+		return true;
+	}
+
+	const GLint maxTextureSize = $(renderer, maxTextureSize);
+	if (width > maxTextureSize || height > maxTextureSize) {
+		MVC_LogWarn("%dx%d glyph atlas exceeds maximum texture size %d\n", width, height, maxTextureSize);
+		return false;
+	}
+
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+	SDL_Surface *surface = SDL_CreateRGBSurface(0, width, height, 32, 0x000000ff, 0x0000ff00, 0x00ff0000, 0xff000000);
+#else
+	SDL_Surface *surface = SDL_CreateRGBSurface(0, width, height, 32, 0xff000000, 0x00ff0000, 0x0000ff00, 0x000000ff);
+#endif
+	assert(surface);
+
+	if (atlas->surface) {
+		SDL_SetSurfaceBlendMode(atlas->surface, SDL_BLENDMODE_NONE);
+		SDL_BlitSurface(atlas->surface, NULL, surface, NULL);
+		SDL_FreeSurface(atlas->surface);
+	}
+
+	atlas->surface = surface;
+	atlas->dirty = true;
+
+	return true;
+}
+
+/**
+ * @brief Discards all glyphs packed into the atlas of the given Font, so that it may be reused.
+ * @remarks Glyph advances are retained, as they do not depend on the atlas.
+ */
+static void resetAtlas(Font *self) {
+
+	FontAtlas *atlas = &self->atlas;
+
+	for (size_t i = 0; i < lengthof(atlas->glyphs); i++) {
+		if (atlas->glyphs[i]) {
+			for (size_t j = 0; j < FONT_ATLAS_PAGE_SIZE; j++) {
+				atlas->glyphs[i][j].frame = MakeRect(0, 0, 0, 0);
+				atlas->glyphs[i][j].rasterized = false;
+			}
+		}
+	}
+
+	SDL_FillRect(atlas->surface, NULL, 0);
+
+	atlas->cursor = MakePoint(0, 0);
+	atlas->rowHeight = 0;
+	atlas->damage = MakeRect(0, 0, 0, 0);
+	atlas->dirty = true;
+}
+
+/**
+ * @brief Packs the given glyph surface into the atlas of the given Font.
+ * @return True if the surface was packed, false if the atlas is full.
+ */
+static _Bool packGlyph(Font *self, const Renderer *renderer, FontGlyph *glyph, SDL_Surface *surface) {
+
+	FontAtlas *atlas = &self->atlas;
+
+	if (atlas->surface == NULL) {
+		if (growAtlas(self, renderer, surface->w + 2, surface->h + 2) == false) {
+			return false;
+		}
+	}
+
+	if (atlas->cursor.x + surface->w + 2 > atlas->surface->w) {
+		if (atlas->surface->w >= atlas->surface->h || growAtlas(self, renderer, atlas->cursor.x + surface->w + 2, 0) == false) {
+			atlas->cursor.x = 0;
+			atlas->cursor.y += atlas->rowHeight + 1;
+			atlas->rowHeight = 0;
+		}
+	}
+
+	if (growAtlas(self, renderer, atlas->cursor.x + surface->w + 2, atlas->cursor.y + surface->h + 2) == false) {
+		return false;
+	}
+
+	glyph->frame = MakeRect(atlas->cursor.x + 1, atlas->cursor.y + 1, surface->w, surface->h);
+
+	SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
+	if (SDL_BlitSurface(surface, NULL, atlas->surface, &glyph->frame)) {
+		MVC_LogError("%s\n", SDL_GetError());
+		return false;
+	}
+
+	atlas->cursor.x += surface->w + 1;
+	atlas->rowHeight = max(atlas->rowHeight, surface->h + 1);
+
+	if (atlas->damage.w && atlas->damage.h) {
+		SDL_UnionRect(&atlas->damage, &glyph->frame, &atlas->damage);
+	} else {
+		atlas->damage = glyph->frame;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Resolves the glyph for the given character, allocating its page if necessary.
+ */
+static FontGlyph *glyphForCharacter(Font *self, Uint16 c) {
+
+	FontGlyph **page = &self->atlas.glyphs[c / FONT_ATLAS_PAGE_SIZE];
+	if (*page == NULL) {
+		*page = calloc(FONT_ATLAS_PAGE_SIZE, sizeof(FontGlyph));
+		assert(*page);
+	}
+
+	return &(*page)[c % FONT_ATLAS_PAGE_SIZE];
+}
+
+/**
+ * @brief Rasterizes the given glyph into the atlas, resetting the atlas if it is full.
+ * @param self The Font.
+ * @param renderer The Renderer, which accounts for rasterized glyphs.
+ * @param glyph The glyph.
+ * @param c The character.
+ * @param chars The UTF-8 sequence of the character.
+ * @param length The length of `chars`.
+ * @return True if the atlas was reset, discarding previously rasterized glyphs.
+ */
+static _Bool rasterizeGlyph(Font *self, Renderer *renderer, FontGlyph *glyph, Uint16 c, const char *chars, size_t length) {
+
+	_Bool reset = false;
+
+	TTF_GlyphMetrics(self->font, c, NULL, NULL, NULL, NULL, &glyph->advance);
+
+	char buffer[5] = { 0 };
+	memcpy(buffer, chars, length);
+
+	SDL_Surface *surface = TTF_RenderUTF8_Blended(self->font, buffer, Colors.White);
+	if (surface) {
+
+		renderer->stats.glyphsRasterized++;
+
+		_Bool packed = packGlyph(self, renderer, glyph, surface);
+		if (packed == false && (self->atlas.cursor.x || self->atlas.cursor.y)) {
+
+			resetAtlas(self);
+			reset = true;
+
+			packed = packGlyph(self, renderer, glyph, surface);
+		}
+
+		glyph->rasterized = packed;
+
+		SDL_FreeSurface(surface);
+	} else {
+		MVC_LogError("%s\n", TTF_GetError());
+	}
+
+	return reset;
+}
+
+/**
+ * @brief Rasterizes any glyphs of the given characters not yet packed into the atlas.
+ * @return True if the atlas was reset, discarding previously rasterized glyphs.
+ */
+static _Bool rasterizeCharacters(Font *self, Renderer *renderer, const char *chars) {
+
+	_Bool reset = false;
+
+	Uint16 c;
+
+	for (const char *s = chars; *s; ) {
+		const size_t length = decodeCharacter(s, &c);
+
+		FontGlyph *glyph = glyphForCharacter(self, c);
+		if (glyph->rasterized == false) {
+			reset |= rasterizeGlyph(self, renderer, glyph, c, s, length);
+		}
+
+		s += length;
+	}
+
+	return reset;
+}
+
+/**
+ * @return The kerning between the given pair of characters, in pixels.
+ */
+static int kerningForCharacters(const Font *self, Uint16 prev, Uint16 c) {
+	return prev ? TTF_GetFontKerningSizeGlyphs(self->font, prev, c) : 0;
+}
+
+/**
+ * @fn void Font::drawCharacters(Font *self, Renderer *renderer, const char *chars, const SDL_Point *origin)
  * @memberof Font
  */
-static Font *initWithAttributes(Font *self, const char *family, int size, int style) {
-	FcResult result;
+static void drawCharacters(Font *self, Renderer *renderer, const char *chars, const SDL_Point *origin) {
+
+	assert(chars);
+	assert(origin);
+
+	if (rasterizeCharacters(self, renderer, chars)) {
+		rasterizeCharacters(self, renderer, chars);
+	}
+
+	FontAtlas *atlas = &self->atlas;
+
+	if (atlas->surface == NULL) {
+		return;
+	}
+
+	if (atlas->dirty || atlas->texture == 0 || atlas->renderer != renderer) {
+
+		if (atlas->texture) {
+			$(atlas->renderer, deleteTexture, atlas->texture);
+			release(atlas->renderer);
+		}
+
+		atlas->texture = $(renderer, createTexture, atlas->surface);
+		atlas->renderer = retain(renderer);
+		atlas->dirty = false;
+	} else if (atlas->damage.w && atlas->damage.h) {
+		$(renderer, updateTexture, atlas->texture, atlas->surface, &atlas->damage);
+	}
+
+	atlas->damage = MakeRect(0, 0, 0, 0);
+
+	const double scale = renderer->metrics.scale;
+	const double w = atlas->surface->w, h = atlas->surface->h;
+
+	double x = origin->x;
+
+	Uint16 c, prev = 0;
+
+	for (const char *s = chars; *s; ) {
+		const size_t length = decodeCharacter(s, &c);
+
+		x += kerningForCharacters(self, prev, c) / scale;
+
+		const FontGlyph *glyph = glyphForCharacter(self, c);
+		if (glyph->rasterized && glyph->frame.w) {
+
+			const GLfloat texcoords[] = {
+				glyph->frame.x / w,
+				glyph->frame.y / h,
+				(glyph->frame.x + glyph->frame.w) / w,
+				(glyph->frame.y + glyph->frame.h) / h
+			};
+
+			const SDL_Rect dest = MakeRect(x, origin->y, glyph->frame.w / scale, glyph->frame.h / scale);
+
+			$(renderer, drawTextureRegion, atlas->texture, texcoords, &dest);
+		}
+
+		x += glyph->advance / scale;
+		prev = c;
+		s += length;
+	}
+}
+
+/**
+ * @brief Creates the Fontconfig search pattern for the given attributes.
+ */
+static FcPattern *patternWithAttributes(const char *family, int size, int style) {
 
 	FcPattern *search = FcPatternCreate();
 	assert(search);
@@ -156,6 +502,153 @@ static Font *initWithAttributes(Font *self, const char *family, int size, int st
 		FcPatternAddString(search, FC_STYLE, (FcChar8 *) "Regular");
 	}
 
+	return search;
+}
+
+/**
+ * @return The key identifying the face resolved by the given Fontconfig pattern, or `NULL`.
+ */
+static String *keyForPattern(const FcPattern *pattern) {
+
+	FcChar8 *file;
+	if (FcPatternGetString(pattern, FC_FILE, 0, &file) == FcResultMatch) {
+
+		double size;
+		if (FcPatternGetDouble(pattern, FC_SIZE, 0, &size) == FcResultMatch) {
+
+			int index = 0;
+			if (FcPatternGetInteger(pattern, FC_INDEX, 0, &index) == FcResultMatch) {
+				return str("%s:%g:%d", (char *) file, size, index);
+			}
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Resolves the shared Font for the given search pattern, memoizing it by `descriptor`.
+ * @param descriptor The descriptor the search pattern was created from.
+ * @param search The Fontconfig search pattern.
+ * @return The retained Font, or `NULL` on error.
+ */
+static Font *fontWithSearchPattern(const String *descriptor, FcPattern *search) {
+
+	Font *font = NULL;
+
+	FcConfigSubstitute(NULL, search, FcMatchPattern);
+	FcDefaultSubstitute(search);
+
+	FcResult result;
+	FcPattern *pattern = FcFontMatch(NULL, search, &result);
+	if (result == FcResultMatch) {
+
+		String *key = keyForPattern(pattern);
+		if (key) {
+
+			font = $((Dictionary *) _fonts, objectForKey, key);
+			if (font) {
+				retain(font);
+			} else {
+				font = $(alloc(Font), initWithPattern, pattern);
+				if (font) {
+					$(_fonts, setObjectForKey, font, key);
+				}
+			}
+
+			if (font) {
+				$(_fontsByDescriptor, setObjectForKey, key, (ident) descriptor);
+			}
+
+			release(key);
+		}
+	}
+
+	if (pattern) {
+		FcPatternDestroy(pattern);
+	}
+
+	if (font == NULL) {
+		MVC_LogWarn("Failed to resolve Font for %s\n", descriptor->chars);
+	}
+
+	return font;
+}
+
+/**
+ * @return The retained shared Font previously resolved for `descriptor`, or `NULL`.
+ */
+static Font *fontWithDescriptor(const String *descriptor) {
+
+	const String *key = $((Dictionary *) _fontsByDescriptor, objectForKey, (ident) descriptor);
+	if (key) {
+
+		Font *font = $((Dictionary *) _fonts, objectForKey, (ident) key);
+		if (font) {
+			return retain(font);
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @fn Font *Font::fontWithAttributes(const char *family, int size, int style)
+ * @memberof Font
+ */
+static Font *fontWithAttributes(const char *family, int size, int style) {
+
+	assert(family);
+
+	String *descriptor = str("%s:%d:%d", family, size, style);
+
+	Font *font = fontWithDescriptor(descriptor);
+	if (font == NULL) {
+		FcPattern *search = patternWithAttributes(family, size, style);
+
+		font = fontWithSearchPattern(descriptor, search);
+
+		FcPatternDestroy(search);
+	}
+
+	release(descriptor);
+	return font;
+}
+
+/**
+ * @fn Font *Font::fontWithName(const char *name)
+ * @memberof Font
+ */
+static Font *fontWithName(const char *name) {
+
+	assert(name);
+
+	String *descriptor = $$(String, stringWithCharacters, name);
+
+	Font *font = fontWithDescriptor(descriptor);
+	if (font == NULL) {
+		FcPattern *search = FcNameParse((FcChar8 *) name);
+		if (search) {
+
+			font = fontWithSearchPattern(descriptor, search);
+
+			FcPatternDestroy(search);
+		}
+	}
+
+	release(descriptor);
+	return font;
+}
+
+/**
+ * @fn Font *Font::initWithAttributes(Font *self, const char *family, int size, int style)
+ * @memberof Font
+ */
+static Font *initWithAttributes(Font *self, const char *family, int size, int style) {
+	FcResult result;
+
+	FcPattern *search = patternWithAttributes(family, size, style);
+
 	FcConfigSubstitute(NULL, search, FcMatchPattern);
 	FcDefaultSubstitute(search);
 
@@ -224,7 +717,19 @@ static Font *initWithPattern(Font *self, ident pattern) {
 			int index = 0;
 			if (FcPatternGetInteger(pattern, FC_INDEX, 0, &index) == FcResultMatch) {
 
-				Data *data = $$(Data, dataWithContentsOfFile, (char *) file);
+				String *path = $$(String, stringWithCharacters, (char *) file);
+
+				Data *data = $((Dictionary *) _fontData, objectForKey, path);
+				if (data) {
+					retain(data);
+				} else {
+					data = $$(Data, dataWithContentsOfFile, (char *) file);
+					if (data) {
+						$(_fontData, setObjectForKey, data, path);
+					}
+				}
+
+				release(path);
 
 				self = $(self, initWithData, data, size, index);
 
@@ -236,6 +741,51 @@ static Font *initWithPattern(Font *self, ident pattern) {
 	return self;
 }
 
+/**
+ * @brief Removes the entries of the given registry that are referenced only by the registry.
+ */
+static void purgeUnreferenced(MutableDictionary *registry) {
+
+	Array *keys = $((Dictionary *) registry, allKeys);
+
+	for (size_t i = 0; i < keys->count; i++) {
+
+		const ident key = $(keys, objectAtIndex, i);
+		const Object *obj = $((Dictionary *) registry, objectForKey, key);
+
+		if (obj->referenceCount == 1) {
+			$(registry, removeObjectForKey, key);
+		}
+	}
+
+	release(keys);
+}
+
+/**
+ * @fn void Font::purgeFonts(void)
+ * @memberof Font
+ */
+static void purgeFonts(void) {
+
+	purgeUnreferenced(_fonts);
+
+	Array *descriptors = $((Dictionary *) _fontsByDescriptor, allKeys);
+
+	for (size_t i = 0; i < descriptors->count; i++) {
+
+		const ident descriptor = $(descriptors, objectAtIndex, i);
+		const ident key = $((Dictionary *) _fontsByDescriptor, objectForKey, descriptor);
+
+		if ($((Dictionary *) _fonts, objectForKey, key) == NULL) {
+			$(_fontsByDescriptor, removeObjectForKey, descriptor);
+		}
+	}
+
+	release(descriptors);
+
+	purgeUnreferenced(_fontData);
+}
+
 /**
  * @fn void Font::renderCharacters(const Font *self, const char *chars, SDL_Color color)
  * @memberof Font
@@ -257,11 +807,21 @@ static SDL_Surface *renderCharacters(const Font *self, const char *chars, SDL_Co
  */
 static void renderDeviceDidReset(Font *self) {
 
+	self->atlas.texture = 0;
+	self->atlas.dirty = true;
+
+	if (self->atlas.renderer) {
+		release(self->atlas.renderer);
+		self->atlas.renderer = NULL;
+	}
+
 	const int renderSize = self->size * MVC_WindowScale(NULL, NULL, NULL);
 	if (renderSize != self->renderSize) {
 
 		self->renderSize = renderSize;
 
+		freeAtlas(&self->atlas);
+
 		if (self->font) {
 			TTF_CloseFont(self->font);
 		}
@@ -299,7 +859,27 @@ void setDefaultFont(FontCategory category, Font *font) {
  */
 static void sizeCharacters(const Font *self, const char *chars, int *w, int *h) {
 
-	TTF_SizeUTF8(self->font, chars, w, h);
+	if (w) {
+		*w = 0;
+
+		Uint16 c, prev = 0;
+
+		for (const char *s = chars; *s; ) {
+			const size_t length = decodeCharacter(s, &c);
+
+			int advance;
+			if (TTF_GlyphMetrics(self->font, c, NULL, NULL, NULL, NULL, &advance) == 0) {
+				*w += kerningForCharacters(self, prev, c) + advance;
+			}
+
+			prev = c;
+			s += length;
+		}
+	}
+
+	if (h) {
+		*h = TTF_FontHeight(self->font);
+	}
 
 	const float scale = MVC_WindowScale(NULL, NULL, NULL);
 	if (w) {
@@ -321,10 +901,14 @@ static void initialize(Class *clazz) {
 
 	((FontInterface *) clazz->def->interface)->allFonts = allFonts;
 	((FontInterface *) clazz->def->interface)->defaultFont = defaultFont;
+	((FontInterface *) clazz->def->interface)->drawCharacters = drawCharacters;
+	((FontInterface *) clazz->def->interface)->fontWithAttributes = fontWithAttributes;
+	((FontInterface *) clazz->def->interface)->fontWithName = fontWithName;
 	((FontInterface *) clazz->def->interface)->initWithAttributes = initWithAttributes;
 	((FontInterface *) clazz->def->interface)->initWithData = initWithData;
 	((FontInterface *) clazz->def->interface)->initWithName = initWithName;
 	((FontInterface *) clazz->def->interface)->initWithPattern = initWithPattern;
+	((FontInterface *) clazz->def->interface)->purgeFonts = purgeFonts;
 	((FontInterface *) clazz->def->interface)->renderCharacters = renderCharacters;
 	((FontInterface *) clazz->def->interface)->renderDeviceDidReset = renderDeviceDidReset;
 	((FontInterface *) clazz->def->interface)->setDefaultFont = setDefaultFont;
@@ -335,6 +919,15 @@ static void initialize(Class *clazz) {
 
 	const int err = TTF_Init();
 	assert(err == 0);
+
+	_fonts = $$(MutableDictionary, dictionary);
+	assert(_fonts);
+
+	_fontsByDescriptor = $$(MutableDictionary, dictionary);
+	assert(_fontsByDescriptor);
+
+	_fontData = $$(MutableDictionary, dictionary);
+	assert(_fontData);
 }
 
 /**
@@ -346,6 +939,10 @@ static void destroy(Class *clazz) {
 		release(_defaultFonts[c]);
 	}
 
+	release(_fontsByDescriptor);
+	release(_fonts);
+	release(_fontData);
+
 	FcFini();
 	TTF_Quit();
 }
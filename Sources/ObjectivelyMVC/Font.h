@@ -28,7 +28,7 @@
 #include <Objectively/Array.h>
 #include <Objectively/Data.h>
 
-#include <ObjectivelyMVC/Types.h>
+#include <ObjectivelyMVC/Renderer.h>
 
 #if defined(__APPLE__)
 #define DEFAULT_FONT_FAMILY "Helvetica Neue"
@@ -69,6 +69,79 @@ typedef enum {
 	FontCategoryMax = 16
 } FontCategory;
 
+/**
+ * @brief The number of glyphs per page in a FontAtlas.
+ */
+#define FONT_ATLAS_PAGE_SIZE 0x100
+
+/**
+ * @brief A glyph rasterized into a FontAtlas.
+ */
+typedef struct {
+
+	/**
+	 * @brief The horizontal advance, in pixels.
+	 */
+	int advance;
+
+	/**
+	 * @brief The frame of the glyph within the atlas, in pixels.
+	 */
+	SDL_Rect frame;
+
+	/**
+	 * @brief True if this glyph has been rasterized.
+	 */
+	_Bool rasterized;
+} FontGlyph;
+
+/**
+ * @brief A grow-on-demand texture of glyphs, shared by all Text rendered in a Font.
+ */
+typedef struct {
+
+	/**
+	 * @brief The glyphs, allocated in pages of FONT_ATLAS_PAGE_SIZE as they are rasterized.
+	 */
+	FontGlyph *glyphs[0x10000 / FONT_ATLAS_PAGE_SIZE];
+
+	/**
+	 * @brief The surface into which glyphs are packed.
+	 */
+	SDL_Surface *surface;
+
+	/**
+	 * @brief The OpenGL texture of `surface`.
+	 */
+	GLuint texture;
+
+	/**
+	 * @brief The Renderer that created `texture`.
+	 */
+	Renderer *renderer;
+
+	/**
+	 * @brief True if `surface` has been reallocated since `texture` was created.
+	 */
+	_Bool dirty;
+
+	/**
+	 * @brief The region of `surface` into which glyphs have been packed since `texture` was last
+	 * updated.
+	 */
+	SDL_Rect damage;
+
+	/**
+	 * @brief The position at which the next glyph will be packed.
+	 */
+	SDL_Point cursor;
+
+	/**
+	 * @brief The height of the current row of glyphs.
+	 */
+	int rowHeight;
+} FontAtlas;
+
 typedef struct Font Font;
 typedef struct FontInterface FontInterface;
 
@@ -89,6 +162,12 @@ struct Font {
 	 */
 	FontInterface *interface;
 
+	/**
+	 * @brief The glyph atlas, valid for the current render size.
+	 * @private
+	 */
+	FontAtlas atlas;
+
 	/**
 	 * @brief The raw font data.
 	 */
@@ -142,6 +221,45 @@ struct FontInterface {
 	 */
 	Font *(*defaultFont)(FontCategory category);
 
+	/**
+	 * @fn void Font::drawCharacters(Font *self, Renderer *renderer, const char *chars, const SDL_Point *origin)
+	 * @brief Draws the given characters as a run of textured quads from this Font's glyph atlas.
+	 * @param self The Font.
+	 * @param renderer The Renderer.
+	 * @param chars The null-terminated UTF-8 encoded C string to draw.
+	 * @param origin The top-left corner of the first character, in object space.
+	 * @remarks Glyphs are rasterized into the atlas the first time they are drawn. The characters
+	 * are modulated by the Renderer's current draw color.
+	 * @memberof Font
+	 */
+	void (*drawCharacters)(Font *self, Renderer *renderer, const char *chars, const SDL_Point *origin);
+
+	/**
+	 * @static
+	 * @fn Font *Font::fontWithAttributes(const char *family, int size, int style)
+	 * @brief Returns the shared Font matching the given attributes via Fontconfig.
+	 * @param family The font family.
+	 * @param size The point size.
+	 * @param style The style.
+	 * @return The retained Font, or `NULL` on error.
+	 * @remarks Fonts are shared by their resolved file, size and index, so repeated requests for
+	 * the same face neither re-read the font file nor open a new TrueType face. Shared Fonts that
+	 * are no longer used are released by Font::purgeFonts.
+	 * @memberof Font
+	 */
+	Font *(*fontWithAttributes)(const char *family, int size, int style);
+
+	/**
+	 * @static
+	 * @fn Font *Font::fontWithName(const char *name)
+	 * @brief Returns the shared Font matching the given Fontconfig name.
+	 * @param name The Fontconfig name.
+	 * @return The retained Font, or `NULL` on error.
+	 * @see Font::fontWithAttributes(const char *, int, int)
+	 * @memberof Font
+	 */
+	Font *(*fontWithName)(const char *name);
+
 	/**
 	 * @fn Font *Font::initWithAttributes(Font *self, const char *family, int size, int style)
 	 * @brief Initializes this Font with the given attributes via Fontconfig.
@@ -187,6 +305,17 @@ struct FontInterface {
 	 */
 	Font *(*initWithPattern)(Font *self, ident pattern);
 
+	/**
+	 * @static
+	 * @fn void Font::purgeFonts(void)
+	 * @brief Releases shared Fonts, and the font files they were read from, that are no longer
+	 * referenced outside of the shared Font registry.
+	 * @remarks Shared Fonts are retained by the registry until they are purged, so that Views
+	 * requesting the same face reuse it.
+	 * @memberof Font
+	 */
+	void (*purgeFonts)(void);
+
 	/**
 	 * @fn void Font::renderCharacters(const Font *self, const char *chars, SDL_Color color)
 	 * @brief Renders the given characters in this Font.
@@ -25,6 +25,10 @@
 
 #include <SDL2/SDL_image.h>
 
+#include <Objectively/MutableArray.h>
+#include <Objectively/MutableDictionary.h>
+#include <Objectively/String.h>
+
 #include <ObjectivelyMVC/Image.h>
 #include <ObjectivelyMVC/Log.h>
 
@@ -34,6 +38,109 @@
 
 #define _Class _Image
 
+/**
+ * @brief Shared Images, keyed by name.
+ */
+static struct {
+	MutableDictionary *images;
+	MutableArray *names;
+	size_t size, budget;
+} _cache;
+
+/**
+ * @brief Images with textures, from most to least recently used.
+ */
+static struct {
+	Image *head, *tail;
+	size_t size, budget;
+} _textures;
+
+/**
+ * @return The size of the given Image's texture, in bytes.
+ */
+static size_t textureSize(const Image *image) {
+	return image->surface->w * image->surface->h * 4;
+}
+
+/**
+ * @brief Releases the least recently requested Images from the cache until it fits its budget.
+ */
+static void trimCache(void) {
+
+	const Array *names = (Array *) _cache.names;
+
+	while (names->count > 1 && _cache.size > _cache.budget) {
+
+		const String *name = $(names, firstObject);
+		const Image *image = $((Dictionary *) _cache.images, objectForKey, (ident) name);
+
+		_cache.size -= textureSize(image);
+
+		$(_cache.images, removeObjectForKey, (ident) name);
+		$(_cache.names, removeObjectAtIndex, 0);
+	}
+}
+
+/**
+ * @brief Removes the given Image from the texture list, without deleting its texture.
+ */
+static void unlinkTexture(Image *image) {
+
+	if (image->texture) {
+
+		if (image->prev) {
+			image->prev->next = image->next;
+		} else {
+			_textures.head = image->next;
+		}
+
+		if (image->next) {
+			image->next->prev = image->prev;
+		} else {
+			_textures.tail = image->prev;
+		}
+
+		image->next = image->prev = NULL;
+
+		_textures.size -= textureSize(image);
+		image->texture = 0;
+	}
+}
+
+/**
+ * @brief Removes the given Image from the texture list, and deletes its texture.
+ */
+static void evictTexture(Image *image) {
+
+	const GLuint texture = image->texture;
+
+	unlinkTexture(image);
+
+	$(image->renderer, deleteTexture, texture);
+
+	release(image->renderer);
+	image->renderer = NULL;
+}
+
+/**
+ * @brief Inserts the given Image at the head of the texture list.
+ */
+static void linkTexture(Image *image, GLuint texture) {
+
+	image->texture = texture;
+	image->prev = NULL;
+	image->next = _textures.head;
+
+	if (_textures.head) {
+		_textures.head->prev = image;
+	} else {
+		_textures.tail = image;
+	}
+
+	_textures.head = image;
+	_textures.size += textureSize(image);
+}
+
 #pragma mark - Object
 
 /**
@@ -43,6 +150,10 @@ static void dealloc(Object *self) {
 
 	Image *this = (Image *) self;
 
+	if (this->texture) {
+		evictTexture(this);
+	}
+
 	SDL_FreeSurface(this->surface);
 
 	super(Object, self, dealloc);
@@ -50,6 +161,40 @@ static void dealloc(Object *self) {
 
 #pragma mark - Image
 
+/**
+ * @fn Image *Image::imageWithName(const char *name)
+ * @memberof Image
+ */
+static Image *imageWithName(const char *name) {
+
+	assert(name);
+
+	String *key = $$(String, stringWithCharacters, name);
+
+	Image *image = $((Dictionary *) _cache.images, objectForKey, key);
+	if (image) {
+		retain(image);
+
+		const String *last = $((Array *) _cache.names, lastObject);
+		if ($((Object *) last, isEqual, (Object *) key) == false) {
+			$(_cache.names, removeObject, key);
+			$(_cache.names, addObject, key);
+		}
+	} else {
+		image = $(alloc(Image), initWithName, name);
+		if (image) {
+			$(_cache.images, setObjectForKey, image, key);
+			$(_cache.names, addObject, key);
+
+			_cache.size += textureSize(image);
+			trimCache();
+		}
+	}
+
+	release(key);
+	return image;
+}
+
 /**
  * @fn Image *Image::initWithBytes(Image *self, const uint8_t *bytes, size_t length)
  * @memberof Image
@@ -118,6 +263,58 @@ Image *initWithSurface(Image *self, SDL_Surface *surface) {
 	return self;
 }
 
+/**
+ * @fn void Image::renderDeviceDidReset(Image *self)
+ * @memberof Image
+ */
+static void renderDeviceDidReset(Image *self) {
+
+	unlinkTexture(self);
+
+	if (self->renderer) {
+		release(self->renderer);
+		self->renderer = NULL;
+	}
+}
+
+/**
+ * @fn void Image::resetTextures(const Renderer *renderer)
+ * @memberof Image
+ */
+static void resetTextures(const Renderer *renderer) {
+
+	Image *image = _textures.head;
+	while (image) {
+
+		Image *next = image->next;
+
+		if (image->renderer == renderer) {
+			$(image, renderDeviceDidReset);
+		}
+
+		image = next;
+	}
+}
+
+/**
+ * @fn void Image::setCacheBudget(size_t budget)
+ * @memberof Image
+ */
+static void setCacheBudget(size_t budget) {
+
+	_cache.budget = budget;
+
+	trimCache();
+}
+
+/**
+ * @fn void Image::setTextureBudget(size_t budget)
+ * @memberof Image
+ */
+static void setTextureBudget(size_t budget) {
+	_textures.budget = budget;
+}
+
 /**
  * @fn SDL_Size Image::size(const Image *self)
  * @memberof Image
@@ -126,6 +323,53 @@ SDL_Size size(const Image *self) {
 	return MakeSize(self->surface->w, self->surface->h);
 }
 
+/**
+ * @fn GLuint Image::texture(Image *self, Renderer *renderer)
+ * @memberof Image
+ */
+static GLuint texture(Image *self, Renderer *renderer) {
+
+	assert(renderer);
+
+	GLuint texture = self->texture;
+	if (texture) {
+		if (self->renderer == renderer) {
+			if (_textures.head != self) {
+				unlinkTexture(self);
+				linkTexture(self, texture);
+			}
+			return texture;
+		}
+
+		evictTexture(self);
+	}
+
+	const size_t size = textureSize(self);
+
+	if (_textures.tail && _textures.size + size > _textures.budget) {
+
+		$(renderer, flush);
+
+		while (_textures.tail && _textures.size + size > _textures.budget) {
+
+			Image *image = _textures.tail;
+
+			MVC_LogDebug("Evicting %dx%d texture\n", image->surface->w, image->surface->h);
+
+			evictTexture(image);
+		}
+	}
+
+	texture = $(renderer, createTexture, self->surface);
+	assert(texture);
+
+	self->renderer = retain(renderer);
+
+	linkTexture(self, texture);
+
+	return texture;
+}
+
 #pragma mark - Class lifecycle
 
 /**
@@ -135,12 +379,28 @@ static void initialize(Class *clazz) {
 
 	((ObjectInterface *) clazz->def->interface)->dealloc = dealloc;
 
+	((ImageInterface *) clazz->def->interface)->imageWithName = imageWithName;
 	((ImageInterface *) clazz->def->interface)->initWithBytes = initWithBytes;
 	((ImageInterface *) clazz->def->interface)->initWithData = initWithData;
 	((ImageInterface *) clazz->def->interface)->initWithName = initWithName;
 	((ImageInterface *) clazz->def->interface)->initWithResource = initWithResource;
 	((ImageInterface *) clazz->def->interface)->initWithSurface = initWithSurface;
+	((ImageInterface *) clazz->def->interface)->renderDeviceDidReset = renderDeviceDidReset;
+	((ImageInterface *) clazz->def->interface)->resetTextures = resetTextures;
+	((ImageInterface *) clazz->def->interface)->setCacheBudget = setCacheBudget;
+	((ImageInterface *) clazz->def->interface)->setTextureBudget = setTextureBudget;
 	((ImageInterface *) clazz->def->interface)->size = size;
+	((ImageInterface *) clazz->def->interface)->texture = texture;
+
+	_cache.images = $$(MutableDictionary, dictionary);
+	assert(_cache.images);
+
+	_cache.names = $$(MutableArray, array);
+	assert(_cache.names);
+
+	_cache.budget = DEFAULT_IMAGE_CACHE_BUDGET;
+
+	_textures.budget = DEFAULT_IMAGE_TEXTURE_BUDGET;
 
 	$$(Resource, addResourcePath, PKGDATADIR);
 
@@ -150,6 +410,15 @@ static void initialize(Class *clazz) {
 	}
 }
 
+/**
+ * @see Class::destroy(Class *)
+ */
+static void destroy(Class *clazz) {
+
+	release(_cache.images);
+	release(_cache.names);
+}
+
 /**
  * @fn Class *Image::_Image(void)
  * @memberof Image
@@ -165,6 +434,7 @@ Class *_Image(void) {
 		clazz.interfaceOffset = offsetof(Image, interface);
 		clazz.interfaceSize = sizeof(ImageInterface);
 		clazz.initialize = initialize;
+		clazz.destroy = destroy;
 	});
 
 	return &clazz;
@@ -21,13 +21,25 @@
 
 #include <Objectively/Resource.h>
 
-#include <ObjectivelyMVC/Types.h>
+#include <ObjectivelyMVC/Renderer.h>
 
 /**
  * @file
  * @brief Image loading.
  */
 
+/**
+ * @brief The default budget for Image textures, in bytes.
+ * @see Image::setTextureBudget(size_t)
+ */
+#define DEFAULT_IMAGE_TEXTURE_BUDGET (64 << 20)
+
+/**
+ * @brief The default budget for Images cached by name, in bytes.
+ * @see Image::setCacheBudget(size_t)
+ */
+#define DEFAULT_IMAGE_CACHE_BUDGET (32 << 20)
+
 typedef struct Image Image;
 typedef struct ImageInterface ImageInterface;
 
@@ -48,10 +60,34 @@ struct Image {
 	 */
 	ImageInterface *interface;
 
+	/**
+	 * @brief The next most recently used Image with a texture.
+	 * @private
+	 */
+	Image *next;
+
+	/**
+	 * @brief The next least recently used Image with a texture.
+	 * @private
+	 */
+	Image *prev;
+
+	/**
+	 * @brief The Renderer that created `texture`.
+	 * @private
+	 */
+	Renderer *renderer;
+
 	/**
 	 * @brief The backing surface.
 	 */
 	SDL_Surface *surface;
+
+	/**
+	 * @brief The texture, shared by all Views drawing this Image, or `0`.
+	 * @private
+	 */
+	GLuint texture;
 };
 
 /**
@@ -64,6 +100,19 @@ struct ImageInterface {
 	 */
 	ObjectInterface objectInterface;
 
+	/**
+	 * @static
+	 * @fn Image *Image::imageWithName(const char *name)
+	 * @brief Returns the shared Image for the Resource by the given name.
+	 * @param name The image name.
+	 * @return The retained Image, or `NULL` on error.
+	 * @remarks Images are cached by name, so that each Resource is decoded once. When the cache
+	 * exceeds its budget, the least recently requested Images are released from it.
+	 * @see Image::setCacheBudget(size_t)
+	 * @memberof Image
+	 */
+	Image *(*imageWithName)(const char *name);
+
 	/**
 	 * @fn Image *Image::initWithBytes(Image *self, const uint8_t *bytes, size_t length)
 	 * @brief Initializes this Image with the specified bytes.
@@ -119,6 +168,47 @@ struct ImageInterface {
 	 */
 	Image *(*initWithSurface)(Image *self, SDL_Surface *surface);
 
+	/**
+	 * @fn void Image::renderDeviceDidReset(Image *self)
+	 * @brief This method should be invoked when the render context is invalidated.
+	 * @param self The Image.
+	 * @memberof Image
+	 */
+	void (*renderDeviceDidReset)(Image *self);
+
+	/**
+	 * @static
+	 * @fn void Image::resetTextures(const Renderer *renderer)
+	 * @brief Discards the textures of all Images uploaded via the given Renderer.
+	 * @param renderer The Renderer, whose render context was invalidated.
+	 * @remarks The textures are not deleted, as they were lost with the render context. This is
+	 * called by Renderer::renderDeviceDidReset.
+	 * @memberof Image
+	 */
+	void (*resetTextures)(const Renderer *renderer);
+
+	/**
+	 * @static
+	 * @fn void Image::setCacheBudget(size_t budget)
+	 * @brief Sets the budget for Images cached by name.
+	 * @param budget The budget, in bytes.
+	 * @remarks Images are released from the cache, least recently requested first, until it fits
+	 * the budget. Images still in use remain valid, but are decoded again if requested by name.
+	 * @memberof Image
+	 */
+	void (*setCacheBudget)(size_t budget);
+
+	/**
+	 * @static
+	 * @fn void Image::setTextureBudget(size_t budget)
+	 * @brief Sets the budget for Image textures.
+	 * @param budget The budget, in bytes.
+	 * @remarks When uploading a texture would exceed the budget, the textures of the least
+	 * recently drawn Images are released. They are uploaded again the next time they are drawn.
+	 * @memberof Image
+	 */
+	void (*setTextureBudget)(size_t budget);
+
 	/**
 	 * @fn SDL_Size Image::size(const Image *self)
 	 * @param self The Image.
@@ -126,6 +216,17 @@ struct ImageInterface {
 	 * @memberof Image
 	 */
 	SDL_Size (*size)(const Image *self);
+
+	/**
+	 * @fn GLuint Image::texture(Image *self, Renderer *renderer)
+	 * @param self The Image.
+	 * @param renderer The Renderer.
+	 * @return This Image's texture, uploading it via `renderer` if necessary.
+	 * @remarks The texture is shared by all Views drawing this Image. If it was created by a
+	 * different Renderer, it is deleted and uploaded again via `renderer`.
+	 * @memberof Image
+	 */
+	GLuint (*texture)(Image *self, Renderer *renderer);
 };
 
 /**
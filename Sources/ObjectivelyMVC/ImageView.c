@@ -53,10 +53,6 @@ static void dealloc(Object *self) {
 
 	release(this->image);
 
-	if (this->texture) {
-		glDeleteTextures(1, &this->texture);
-	}
-
 	super(Object, self, dealloc);
 }
 
@@ -97,20 +93,15 @@ static void render(View *self, Renderer *renderer) {
 
 	ImageView *this = (ImageView *) self;
 
-	if (this->texture == 0) {
-		if (this->image) {
-			this->texture = $(renderer, createTexture, this->image->surface);
-			assert(this->texture);
-		}
-	}
+	if (this->image) {
 
-	if (this->texture) {
+		const GLuint texture = $(this->image, texture, renderer);
 
 		// TODO: Actually use self->blend
 
 		$(renderer, setDrawColor, &this->color);
 		const SDL_Rect frame = $(self, renderFrame);
-		$(renderer, drawTexture, this->texture, &frame);
+		$(renderer, drawTexture, texture, &frame);
 		$(renderer, setDrawColor, &Colors.White);
 	}
 }
@@ -124,7 +115,9 @@ static void renderDeviceDidReset(View *self) {
 
 	ImageView *this = (ImageView *) self;
 
-	this->texture = 0;
+	if (this->image) {
+		$(this->image, renderDeviceDidReset);
+	}
 }
 
 #pragma mark - ImageView
@@ -181,7 +174,7 @@ static void setImage(ImageView *self, Image *image) {
 		self->image = NULL;
 	}
 
-	self->texture = 0;
+	$((View *) self, setNeedsDisplay);
 }
 
 /**
@@ -69,11 +69,6 @@ struct ImageView {
 	 * @brief The image.
 	 */
 	Image *image;
-
-	/**
-	 * @brief The texture.
-	 */
-	GLuint texture;
 };
 
 /**
@@ -58,7 +58,7 @@ static void awakeWithDictionary(View *self, const Dictionary *dictionary) {
 
 	$(self, bind, inlets, dictionary);
 
-	self->needsLayout = true;
+	$(self, setNeedsLayout);
 }
 
 /**
@@ -52,6 +52,13 @@ static View *init(View *self) {
 	return (View *) $((PageView *) self, initWithFrame, NULL);
 }
 
+/**
+ * @see View::isVisibleSubview(const View *, const View *)
+ */
+static _Bool isVisibleSubview(const View *self, const View *subview) {
+	return true;
+}
+
 /**
  * @see View::removeSubview(View *, View *)
  */
@@ -72,13 +79,6 @@ static void removeSubview(View *self, View *subview) {
 	release(subview);
 }
 
-/**
- * @see View::visibleSubviews(const View *)
- */
-static Array *visibleSubviews(const View *self) {
-	return $$(Array, arrayWithArray, (Array *) self->subviews);
-}
-
 #pragma mark - PageView
 
 /**
@@ -137,7 +137,7 @@ static void setCurrentPage(PageView *self, View *currentPage) {
 			}
 		}
 
-		self->view.needsLayout = true;
+		$((View *) self, setNeedsLayout);
 	}
 }
 
@@ -150,8 +150,8 @@ static void initialize(Class *clazz) {
 
 	((ViewInterface *) clazz->def->interface)->addSubview = addSubview;
 	((ViewInterface *) clazz->def->interface)->init = init;
+	((ViewInterface *) clazz->def->interface)->isVisibleSubview = isVisibleSubview;
 	((ViewInterface *) clazz->def->interface)->removeSubview = removeSubview;
-	((ViewInterface *) clazz->def->interface)->visibleSubviews = visibleSubviews;
 
 	((PageViewInterface *) clazz->def->interface)->initWithFrame = initWithFrame;
 	((PageViewInterface *) clazz->def->interface)->setCurrentPage = setCurrentPage;
@@ -153,8 +153,14 @@ static _Bool captureEvent(Control *self, const SDL_Event *event) {
 
 			$((View *) self, resize, &size);
 		} else if (this->isDragging) {
+			$((View *) self, setNeedsDisplay);
+
 			self->view.frame.x += event->motion.xrel;
 			self->view.frame.y += event->motion.yrel;
+
+			MVC_InvalidateRenderFrames();
+
+			$((View *) self, setNeedsDisplay);
 		}
 
 		return true;
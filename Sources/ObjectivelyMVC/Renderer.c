@@ -22,31 +22,365 @@
  */
 
 #include <assert.h>
+#include <stdlib.h>
+#include <string.h>
 
+#include <ObjectivelyMVC/Image.h>
 #include <ObjectivelyMVC/Log.h>
 #include <ObjectivelyMVC/Renderer.h>
+#include <ObjectivelyMVC/Trace.h>
 #include <ObjectivelyMVC/View.h>
 #include <ObjectivelyMVC/Window.h>
 
+#define RENDERER_BATCH_CAPACITY 1024
+
+/**
+ * @brief The timer query entry points, resolved via SDL_GL_GetProcAddress.
+ */
+static struct {
+	PFNGLBEGINQUERYPROC BeginQuery;
+	PFNGLDELETEQUERIESPROC DeleteQueries;
+	PFNGLENDQUERYPROC EndQuery;
+	PFNGLGENQUERIESPROC GenQueries;
+	PFNGLGETQUERYOBJECTIVPROC GetQueryObjectiv;
+	PFNGLGETQUERYOBJECTUI64VPROC GetQueryObjectui64v;
+} gl;
+
+#define GetProcAddress(name) (gl.name = SDL_GL_GetProcAddress("gl" #name))
+
 #define _Class _Renderer
 
+#pragma mark - Object
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	Renderer *this = (Renderer *) self;
+
+	if (this->backBuffer) {
+		glDeleteTextures(1, &this->backBuffer);
+	}
+
+	if (this->timer.queries[0]) {
+		gl.DeleteQueries(2, this->timer.queries);
+	}
+
+	free(this->batch.vertices);
+
+	super(Object, self, dealloc);
+}
+
 #pragma mark - Renderer
 
+/**
+ * @brief Reserves `count` vertices in the batch, flushing it first if `mode` or `texture` differ.
+ * @return The reserved vertices, colored with the current draw color.
+ */
+static RendererVertex *reserveVertices(Renderer *self, GLenum mode, GLuint texture, size_t count) {
+
+	RendererBatch *batch = &self->batch;
+
+	if (batch->count && (batch->mode != mode || batch->texture != texture)) {
+		$(self, flush);
+	}
+
+	batch->mode = mode;
+	batch->texture = texture;
+
+	if (batch->count + count > batch->capacity) {
+
+		size_t capacity = batch->capacity ?: RENDERER_BATCH_CAPACITY;
+		while (capacity < batch->count + count) {
+			capacity *= 2;
+		}
+
+		batch->vertices = realloc(batch->vertices, capacity * sizeof(RendererVertex));
+		assert(batch->vertices);
+
+		batch->capacity = capacity;
+	}
+
+	RendererVertex *vertices = batch->vertices + batch->count;
+	for (size_t i = 0; i < count; i++) {
+		vertices[i].color = self->drawColor;
+	}
+
+	batch->count += count;
+
+	return vertices;
+}
+
+/**
+ * @return The bounds of the current OpenGL window, in object space.
+ */
+static SDL_Rect windowFrame(void) {
+
+	SDL_Rect frame = MakeRect(0, 0, 0, 0);
+	SDL_GetWindowSize(SDL_GL_GetCurrentWindow(), &frame.w, &frame.h);
+
+	return frame;
+}
+
+/**
+ * @brief Resolves the window metrics for the current frame.
+ */
+static void resolveMetrics(Renderer *self) {
+
+	self->metrics.window = SDL_GL_GetCurrentWindow();
+	assert(self->metrics.window);
+
+	SDL_GetWindowSize(self->metrics.window, &self->metrics.size.w, &self->metrics.size.h);
+	SDL_GL_GetDrawableSize(self->metrics.window, &self->metrics.drawableSize.w, &self->metrics.drawableSize.h);
+
+	if (self->metrics.size.h && self->metrics.drawableSize.h) {
+		self->metrics.scale = self->metrics.drawableSize.h / (double) self->metrics.size.h;
+	} else {
+		self->metrics.scale = 1.0;
+	}
+}
+
+/**
+ * @return The given rectangle, in object space, transformed to window coordinates.
+ * @see MVC_TransformToWindow(SDL_Window *, const SDL_Rect *)
+ */
+static SDL_Rect transformToWindow(const Renderer *self, const SDL_Rect *rect) {
+
+	const double scale = self->metrics.scale;
+
+	SDL_Rect transformed = MakeRect(rect->x * scale, rect->y * scale, rect->w * scale, rect->h * scale);
+	transformed.y = self->metrics.drawableSize.h - transformed.h - transformed.y;
+
+	return transformed;
+}
+
+/**
+ * @brief Binds the given texture, enabling or disabling texturing as required.
+ */
+static void bindTexture(Renderer *self, GLuint texture) {
+
+	if (texture) {
+		if (self->state.texture2D == false) {
+			glEnable(GL_TEXTURE_2D);
+			self->state.texture2D = true;
+		}
+		if (self->state.texture != texture) {
+			glBindTexture(GL_TEXTURE_2D, texture);
+			self->state.texture = texture;
+		}
+	} else {
+		if (self->state.texture2D) {
+			glDisable(GL_TEXTURE_2D);
+			self->state.texture2D = false;
+		}
+	}
+}
+
+/**
+ * @brief Enables or disables the client-side vertex arrays.
+ */
+static void enableVertexArrays(Renderer *self, _Bool enabled) {
+
+	if (self->state.vertexArrays != enabled) {
+
+		if (enabled) {
+			glEnableClientState(GL_VERTEX_ARRAY);
+			glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+			glEnableClientState(GL_COLOR_ARRAY);
+		} else {
+			glDisableClientState(GL_VERTEX_ARRAY);
+			glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+			glDisableClientState(GL_COLOR_ARRAY);
+
+			glColor4ub(255, 255, 255, 255);
+		}
+
+		self->state.vertexArrays = enabled;
+	}
+}
+
+/**
+ * @brief Begins the GPU timer query for the current frame, reading the result of the query issued
+ * two frames ago if it is available.
+ */
+static void beginTimerQuery(Renderer *self) {
+
+	if (self->timerQueries == false) {
+		return;
+	}
+
+	if (self->timer.queries[0] == 0) {
+
+		const _Bool extension = SDL_GL_ExtensionSupported("GL_ARB_timer_query")
+			|| SDL_GL_ExtensionSupported("GL_EXT_timer_query");
+
+		const _Bool supported = extension
+			&& GetProcAddress(BeginQuery)
+			&& GetProcAddress(DeleteQueries)
+			&& GetProcAddress(EndQuery)
+			&& GetProcAddress(GenQueries)
+			&& GetProcAddress(GetQueryObjectiv)
+			&& GetProcAddress(GetQueryObjectui64v);
+
+		if (supported == false) {
+			MVC_LogWarn("Timer queries are not supported\n");
+			self->timerQueries = false;
+			return;
+		}
+
+		gl.GenQueries(2, self->timer.queries);
+	}
+
+	const int i = self->timer.index;
+
+	if (self->timer.pending[i]) {
+
+		GLint available = 0;
+		gl.GetQueryObjectiv(self->timer.queries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+
+		if (available) {
+			GLuint64 elapsed;
+			gl.GetQueryObjectui64v(self->timer.queries[i], GL_QUERY_RESULT, &elapsed);
+
+			self->timer.gpuTime = elapsed / 1000000.0;
+		}
+
+		self->timer.pending[i] = false;
+	}
+
+	gl.BeginQuery(GL_TIME_ELAPSED, self->timer.queries[i]);
+	self->timer.active = true;
+}
+
+/**
+ * @brief Ends the GPU timer query for the current frame, if one is in progress.
+ */
+static void endTimerQuery(Renderer *self) {
+
+	if (self->timer.active) {
+
+		gl.EndQuery(GL_TIME_ELAPSED);
+
+		self->timer.pending[self->timer.index] = true;
+		self->timer.index ^= 1;
+		self->timer.active = false;
+	}
+}
+
+/**
+ * @brief Restores the undamaged regions of the back buffer from the previous frame, and clears the
+ * damaged region. If no usable copy of the previous frame exists, the entire window is damaged.
+ */
+static void restoreBackBuffer(Renderer *self) {
+
+	const SDL_Size size = self->metrics.drawableSize;
+	const SDL_Rect frame = MakeRect(0, 0, self->metrics.size.w, self->metrics.size.h);
+
+	if (self->backBuffer == 0 || self->backBufferSize.w != size.w || self->backBufferSize.h != size.h) {
+		self->damage = frame;
+		return;
+	}
+
+	if (SDL_RectEquals(&self->damage, &frame)) {
+		return;
+	}
+
+	const GLfloat texcoords[] = { 0.0, 1.0, 1.0, 0.0 };
+
+	$(self, setClippingFrame, NULL);
+	$(self, drawTextureRegion, self->backBuffer, texcoords, &frame);
+
+	if (SDL_RectEmpty(&self->damage) == false) {
+		$(self, setClippingFrame, &self->damage);
+		$(self, flush);
+
+		glClear(GL_COLOR_BUFFER_BIT);
+	}
+}
+
+/**
+ * @brief Copies the damaged region of the back buffer so that it may be restored next frame.
+ */
+static void copyBackBuffer(Renderer *self) {
+
+	const SDL_Size size = self->metrics.drawableSize;
+
+	SDL_Rect rect;
+	if (self->backBuffer == 0 || self->backBufferSize.w != size.w || self->backBufferSize.h != size.h) {
+
+		if (self->backBuffer == 0) {
+			glGenTextures(1, &self->backBuffer);
+		}
+
+		glBindTexture(GL_TEXTURE_2D, self->backBuffer);
+		self->state.texture = self->backBuffer;
+
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, size.w, size.h, 0, GL_RGB, GL_UNSIGNED_BYTE, NULL);
+
+		self->backBufferSize = size;
+
+		rect = MakeRect(0, 0, size.w, size.h);
+	} else {
+		if (SDL_RectEmpty(&self->damage)) {
+			return;
+		}
+
+		const SDL_Rect bounds = MakeRect(0, 0, size.w, size.h);
+		const SDL_Rect transformed = transformToWindow(self, &self->damage);
+		if (SDL_IntersectRect(&transformed, &bounds, &rect) == false) {
+			return;
+		}
+	}
+
+	if (self->state.texture != self->backBuffer) {
+		glBindTexture(GL_TEXTURE_2D, self->backBuffer);
+		self->state.texture = self->backBuffer;
+	}
+
+	glCopyTexSubImage2D(GL_TEXTURE_2D, 0, rect.x, rect.y, rect.x, rect.y, rect.w, rect.h);
+}
+
 /**
  * @fn void Renderer::beginFrame(Renderer *self)
  * @memberof Renderer
  */
 static void beginFrame(Renderer *self) {
 
+	MVC_TraceBegin("beginFrame");
+
+	memset(&self->stats, 0, sizeof(self->stats));
+
+	beginTimerQuery(self);
+
+	self->stats.gpuTime = self->timer.gpuTime;
+
+	resolveMetrics(self);
+
 	glEnable(GL_BLEND);
 	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
 	glEnable(GL_SCISSOR_TEST);
 
-	glEnableClientState(GL_VERTEX_ARRAY);
-	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+	self->batch.count = 0;
+	self->scissor = MakeRect(0, 0, 0, 0);
+
+	self->state.texture = 0;
+	self->state.texture2D = false;
+	self->state.vertexArrays = false;
 
 	$(self, setDrawColor, &Colors.White);
+
+	if (self->partialRedraw) {
+		restoreBackBuffer(self);
+	} else {
+		self->damage = MakeRect(0, 0, self->metrics.size.w, self->metrics.size.h);
+	}
+
+	MVC_TraceEnd("beginFrame");
 }
 
 /**
@@ -84,108 +418,192 @@ static GLuint createTexture(const Renderer *self, const SDL_Surface *surface) {
 
 	glTexImage2D(GL_TEXTURE_2D, 0, format, surface->w, surface->h, 0, format, GL_UNSIGNED_BYTE, surface->pixels);
 
+	glBindTexture(GL_TEXTURE_2D, self->state.texture);
+
+	((Renderer *) self)->stats.textureUploads++;
+
 	return texture;
 }
 
 /**
- * @fn void Renderer::drawLine(const Renderer *self, const SDL_Point *points)
+ * @fn GLuint Renderer::createTextureWithFramebuffer(Renderer *self, const SDL_Rect *rect)
  * @memberof Renderer
  */
-static void drawLine(const Renderer *self, const SDL_Point *points) {
+static GLuint createTextureWithFramebuffer(Renderer *self, const SDL_Rect *rect) {
 
-	assert(points);
+	assert(rect);
 
-	$(self, drawLines, points, 2);
+	$(self, flush);
+
+	const SDL_Rect transformed = transformToWindow(self, rect);
+	if (transformed.w <= 0 || transformed.h <= 0) {
+		return 0;
+	}
+
+	GLuint texture;
+	glGenTextures(1, &texture);
+
+	glBindTexture(GL_TEXTURE_2D, texture);
+	self->state.texture = texture;
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+	glCopyTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, transformed.x, transformed.y, transformed.w, transformed.h, 0);
+
+	return texture;
 }
 
 /**
- * @fn void Renderer::drawLines(const Renderer *self, const SDL_Point *points, size_t count)
+ * @fn void Renderer::deleteTexture(Renderer *self, GLuint texture)
  * @memberof Renderer
  */
-static void drawLines(const Renderer *self, const SDL_Point *points, size_t count) {
+static void deleteTexture(Renderer *self, GLuint texture) {
 
-	assert(points);
+	if (texture) {
+
+		$(self, flush);
 
-	glVertexPointer(2, GL_INT, 0, points);
+		if (self->state.texture == texture) {
+			self->state.texture = 0;
+		}
 
-	glDrawArrays(GL_LINE_STRIP, 0, (GLsizei) count);
+		glDeleteTextures(1, &texture);
+	}
 }
 
 /**
- * @fn void Renderer::drawRect(const Renderer *self, const SDL_Rect *rect)
+ * @fn void Renderer::drawLine(Renderer *self, const SDL_Point *points)
  * @memberof Renderer
  */
-static void drawRect(const Renderer *self, const SDL_Rect *rect) {
+static void drawLine(Renderer *self, const SDL_Point *points) {
 
-	assert(rect);
+	assert(points);
+
+	$(self, drawLines, points, 2);
+}
+
+/**
+ * @fn void Renderer::drawLines(Renderer *self, const SDL_Point *points, size_t count)
+ * @memberof Renderer
+ */
+static void drawLines(Renderer *self, const SDL_Point *points, size_t count) {
 
-	GLint verts[8];
+	assert(points);
 
-	verts[0] = rect->x;
-	verts[1] = rect->y;
+	if (count < 2) {
+		return;
+	}
 
-	verts[2] = rect->x + rect->w;
-	verts[3] = rect->y;
+	RendererVertex *v = reserveVertices(self, GL_LINES, 0, (count - 1) * 2);
 
-	verts[4] = rect->x + rect->w;
-	verts[5] = rect->y + rect->h;
+	for (size_t i = 1; i < count; i++) {
 
-	verts[6] = rect->x;
-	verts[7] = rect->y + rect->h;
+		v->x = points[i - 1].x;
+		v->y = points[i - 1].y;
+		v++;
+
+		v->x = points[i].x;
+		v->y = points[i].y;
+		v++;
+	}
 
-	glVertexPointer(2, GL_INT, 0, verts);
-	glDrawArrays(GL_LINE_LOOP, 0, 4);
+	if (self->batching == false) {
+		$(self, flush);
+	}
 }
 
 /**
- * @fn void Renderer::drawRectFilled(const Renderer *self, const SDL_Rect *rect)
+ * @fn void Renderer::drawRect(Renderer *self, const SDL_Rect *rect)
  * @memberof Renderer
  */
-static void drawRectFilled(const Renderer *self, const SDL_Rect *rect) {
+static void drawRect(Renderer *self, const SDL_Rect *rect) {
 
 	assert(rect);
 
-	glRecti(rect->x - 1, rect->y - 1, rect->x + rect->w + 1, rect->y + rect->h + 1);
+	const SDL_Point points[] = {
+		MakePoint(rect->x, rect->y),
+		MakePoint(rect->x + rect->w, rect->y),
+		MakePoint(rect->x + rect->w, rect->y + rect->h),
+		MakePoint(rect->x, rect->y + rect->h),
+		MakePoint(rect->x, rect->y)
+	};
+
+	$(self, drawLines, points, lengthof(points));
 }
 
 /**
- * @fn void Renderer::drawTexture(const Renderer *self, GLuint texture, const SDL_Rect *dest)
+ * @fn void Renderer::drawRectFilled(Renderer *self, const SDL_Rect *rect)
  * @memberof Renderer
  */
-static void drawTexture(const Renderer *self, GLuint texture, const SDL_Rect *rect) {
+static void drawRectFilled(Renderer *self, const SDL_Rect *rect) {
 
 	assert(rect);
 
-	const GLfloat texcoords[] = {
-		0.0, 0.0,
-		1.0, 0.0,
-		1.0, 1.0,
-		0.0, 1.0
-	};
+	RendererVertex *v = reserveVertices(self, GL_QUADS, 0, 4);
 
-	GLint verts[8];
+	v[0].x = rect->x - 1;
+	v[0].y = rect->y - 1;
 
-	verts[0] = rect->x;
-	verts[1] = rect->y;
+	v[1].x = rect->x + rect->w + 1;
+	v[1].y = rect->y - 1;
 
-	verts[2] = rect->x + rect->w;
-	verts[3] = rect->y;
+	v[2].x = rect->x + rect->w + 1;
+	v[2].y = rect->y + rect->h + 1;
 
-	verts[4] = rect->x + rect->w;
-	verts[5] = rect->y + rect->h;
+	v[3].x = rect->x - 1;
+	v[3].y = rect->y + rect->h + 1;
 
-	verts[6] = rect->x;
-	verts[7] = rect->y + rect->h;
+	if (self->batching == false) {
+		$(self, flush);
+	}
+}
 
-	glEnable(GL_TEXTURE_2D);
-	glBindTexture(GL_TEXTURE_2D, texture);
+/**
+ * @fn void Renderer::drawTexture(Renderer *self, GLuint texture, const SDL_Rect *dest)
+ * @memberof Renderer
+ */
+static void drawTexture(Renderer *self, GLuint texture, const SDL_Rect *rect) {
+
+	const GLfloat texcoords[] = { 0.0, 0.0, 1.0, 1.0 };
+
+	$(self, drawTextureRegion, texture, texcoords, rect);
+}
+
+/**
+ * @fn void Renderer::drawTextureRegion(Renderer *self, GLuint texture, const GLfloat *texcoords, const SDL_Rect *dest)
+ * @memberof Renderer
+ */
+static void drawTextureRegion(Renderer *self, GLuint texture, const GLfloat *texcoords, const SDL_Rect *rect) {
+
+	assert(texcoords);
+	assert(rect);
+
+	RendererVertex *v = reserveVertices(self, GL_QUADS, texture, 4);
+
+	v[0].x = rect->x;
+	v[0].y = rect->y;
+	v[0].s = texcoords[0];
+	v[0].t = texcoords[1];
+
+	v[1].x = rect->x + rect->w;
+	v[1].y = rect->y;
+	v[1].s = texcoords[2];
+	v[1].t = texcoords[1];
 
-	glVertexPointer(2, GL_INT, 0, verts);
-	glTexCoordPointer(2, GL_FLOAT, 0, texcoords);
+	v[2].x = rect->x + rect->w;
+	v[2].y = rect->y + rect->h;
+	v[2].s = texcoords[2];
+	v[2].t = texcoords[3];
 
-	glDrawArrays(GL_QUADS, 0, 4);
+	v[3].x = rect->x;
+	v[3].y = rect->y + rect->h;
+	v[3].s = texcoords[0];
+	v[3].t = texcoords[3];
 
-	glDisable(GL_TEXTURE_2D);
+	if (self->batching == false) {
+		$(self, flush);
+	}
 }
 
 /**
@@ -211,22 +629,64 @@ static void drawView(Renderer *self, View *view) {
  */
 static void endFrame(Renderer *self) {
 
-	$(self, setDrawColor, &Colors.White);
+	MVC_TraceBegin("endFrame");
+
+	$(self, flush);
+
+	if (self->partialRedraw) {
+		copyBackBuffer(self);
+	}
 
-	glDisableClientState(GL_VERTEX_ARRAY);
-	glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+	self->damage = MakeRect(0, 0, self->metrics.size.w, self->metrics.size.h);
+
+	$(self, setDrawColor, &Colors.White);
 
 	$(self, setClippingFrame, NULL);
 
+	bindTexture(self, 0);
+	enableVertexArrays(self, false);
+
 	glDisable(GL_SCISSOR_TEST);
 
 	glBlendFunc(GL_ONE, GL_ZERO);
 	glDisable(GL_BLEND);
 
+	endTimerQuery(self);
+
 	const GLenum err = glGetError();
 	if (err) {
 		MVC_LogError("GL error: %d\n", err);
 	}
+
+	MVC_TraceEnd("endFrame");
+}
+
+/**
+ * @fn void Renderer::flush(Renderer *self)
+ * @memberof Renderer
+ */
+static void flush(Renderer *self) {
+
+	RendererBatch *batch = &self->batch;
+
+	if (batch->count) {
+
+		bindTexture(self, batch->texture);
+		enableVertexArrays(self, true);
+
+		const RendererVertex *v = batch->vertices;
+
+		glVertexPointer(2, GL_INT, sizeof(RendererVertex), &v->x);
+		glTexCoordPointer(2, GL_FLOAT, sizeof(RendererVertex), &v->s);
+		glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(RendererVertex), &v->color);
+
+		glDrawArrays(batch->mode, 0, (GLsizei) batch->count);
+
+		self->stats.drawCalls++;
+		self->stats.vertices += batch->count;
+
+		batch->count = 0;
+	}
 }
 
 /**
@@ -234,7 +694,26 @@ static void endFrame(Renderer *self) {
  * @memberof Renderer
  */
 static Renderer *init(Renderer *self) {
-	return (Renderer *) super(Object, self, init);
+
+	self = (Renderer *) super(Object, self, init);
+	if (self) {
+		self->batching = true;
+		self->drawColor = Colors.White;
+	}
+
+	return self;
+}
+
+/**
+ * @fn GLint Renderer::maxTextureSize(const Renderer *self)
+ * @memberof Renderer
+ */
+static GLint maxTextureSize(const Renderer *self) {
+
+	GLint size = 0;
+	glGetIntegerv(GL_MAX_TEXTURE_SIZE, &size);
+
+	return size;
 }
 
 /**
@@ -243,6 +722,14 @@ static Renderer *init(Renderer *self) {
  */
 static void renderDeviceDidReset(Renderer *self) {
 
+	self->batch.count = 0;
+
+	self->backBuffer = 0;
+	self->backBufferSize = MakeSize(0, 0);
+
+	memset(&self->timer, 0, sizeof(self->timer));
+
+	$$(Image, resetTextures, self);
 }
 
 /**
@@ -251,19 +738,39 @@ static void renderDeviceDidReset(Renderer *self) {
  */
 static void setClippingFrame(Renderer *self, const SDL_Rect *clippingFrame) {
 
-	SDL_Window *window = SDL_GL_GetCurrentWindow();
-
 	SDL_Rect rect;
 	if (clippingFrame) {
 		rect = *clippingFrame;
 	} else {
-		rect = MakeRect(0, 0, 0, 0);
-		SDL_GL_GetDrawableSize(window, &rect.w, &rect.h);
+		rect = MakeRect(0, 0, self->metrics.size.w, self->metrics.size.h);
 	}
 
-	const SDL_Rect scissor = MVC_TransformToWindow(window, &rect);
+	const SDL_Rect transformed = transformToWindow(self, &rect);
+	const SDL_Rect scissor = MakeRect(transformed.x - 1, transformed.y - 1, transformed.w + 1, transformed.h + 1);
+
+	if (SDL_RectEquals(&scissor, &self->scissor) == false) {
+
+		$(self, flush);
 
-	glScissor(scissor.x - 1, scissor.y - 1, scissor.w + 1, scissor.h + 1);
+		glScissor(scissor.x, scissor.y, scissor.w, scissor.h);
+
+		self->stats.scissorChanges++;
+
+		self->scissor = scissor;
+	}
+}
+
+/**
+ * @fn void Renderer::setDamage(Renderer *self, const SDL_Rect *damage)
+ * @memberof Renderer
+ */
+static void setDamage(Renderer *self, const SDL_Rect *damage) {
+
+	if (damage) {
+		self->damage = *damage;
+	} else {
+		self->damage = windowFrame();
+	}
 }
 
 /**
@@ -271,7 +778,58 @@ static void setClippingFrame(Renderer *self, const SDL_Rect *clippingFrame) {
  * @memberof Renderer
  */
 static void setDrawColor(Renderer *self, const SDL_Color *color) {
-	glColor4ubv((const GLubyte *) color);
+
+	assert(color);
+
+	self->drawColor = *color;
+}
+
+/**
+ * @fn void Renderer::updateTexture(Renderer *self, GLuint texture, const SDL_Surface *surface, const SDL_Rect *rect)
+ * @memberof Renderer
+ */
+static void updateTexture(Renderer *self, GLuint texture, const SDL_Surface *surface, const SDL_Rect *rect) {
+
+	assert(surface);
+	assert(rect);
+
+	GLenum format;
+	switch (surface->format->BytesPerPixel) {
+		case 1:
+			format = GL_LUMINANCE;
+			break;
+		case 3:
+			format = GL_RGB;
+			break;
+		case 4:
+			format = GL_RGBA;
+			break;
+		default:
+			MVC_LogError("Invalid surface format: %s\n", SDL_GetPixelFormatName(surface->format->format));
+			return;
+	}
+
+	$(self, flush);
+
+	const int bytesPerPixel = surface->format->BytesPerPixel;
+	const Uint8 *pixels = (Uint8 *) surface->pixels + rect->y * surface->pitch + rect->x * bytesPerPixel;
+
+	glBindTexture(GL_TEXTURE_2D, texture);
+
+	GLint alignment, rowLength;
+	glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+	glGetIntegerv(GL_UNPACK_ROW_LENGTH, &rowLength);
+
+	// SDL pads rows of 24 bit surfaces to 4 bytes, which the unpack alignment accounts for
+	glPixelStorei(GL_UNPACK_ALIGNMENT, surface->pitch % 4 ? 1 : 4);
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, surface->pitch / bytesPerPixel);
+
+	glTexSubImage2D(GL_TEXTURE_2D, 0, rect->x, rect->y, rect->w, rect->h, format, GL_UNSIGNED_BYTE, pixels);
+
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, rowLength);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+
+	glBindTexture(GL_TEXTURE_2D, self->state.texture);
 }
 
 #pragma mark - Class lifecycle
@@ -280,20 +838,29 @@ static void setDrawColor(Renderer *self, const SDL_Color *color) {
  * @see Class::initialize(Class *)
  */
 static void initialize(Class *clazz) {
-	
+
+	((ObjectInterface *) clazz->def->interface)->dealloc = dealloc;
+
 	((RendererInterface *) clazz->def->interface)->beginFrame = beginFrame;
 	((RendererInterface *) clazz->def->interface)->createTexture = createTexture;
+	((RendererInterface *) clazz->def->interface)->createTextureWithFramebuffer = createTextureWithFramebuffer;
+	((RendererInterface *) clazz->def->interface)->deleteTexture = deleteTexture;
 	((RendererInterface *) clazz->def->interface)->drawLine = drawLine;
 	((RendererInterface *) clazz->def->interface)->drawLines = drawLines;
 	((RendererInterface *) clazz->def->interface)->drawRect = drawRect;
 	((RendererInterface *) clazz->def->interface)->drawRectFilled = drawRectFilled;
 	((RendererInterface *) clazz->def->interface)->drawTexture = drawTexture;
+	((RendererInterface *) clazz->def->interface)->drawTextureRegion = drawTextureRegion;
 	((RendererInterface *) clazz->def->interface)->drawView = drawView;
 	((RendererInterface *) clazz->def->interface)->endFrame = endFrame;
+	((RendererInterface *) clazz->def->interface)->flush = flush;
 	((RendererInterface *) clazz->def->interface)->init = init;
+	((RendererInterface *) clazz->def->interface)->maxTextureSize = maxTextureSize;
 	((RendererInterface *) clazz->def->interface)->renderDeviceDidReset = renderDeviceDidReset;
 	((RendererInterface *) clazz->def->interface)->setClippingFrame = setClippingFrame;
+	((RendererInterface *) clazz->def->interface)->setDamage = setDamage;
 	((RendererInterface *) clazz->def->interface)->setDrawColor = setDrawColor;
+	((RendererInterface *) clazz->def->interface)->updateTexture = updateTexture;
 }
 
 /**
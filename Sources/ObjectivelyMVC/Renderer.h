@@ -40,11 +40,113 @@
 typedef struct Renderer Renderer;
 typedef struct RendererInterface RendererInterface;
 
+/**
+ * @brief A vertex in the Renderer's batch.
+ */
+typedef struct {
+
+	/**
+	 * @brief The position, in object space.
+	 */
+	GLint x, y;
+
+	/**
+	 * @brief The texture coordinates.
+	 */
+	GLfloat s, t;
+
+	/**
+	 * @brief The color.
+	 */
+	SDL_Color color;
+} RendererVertex;
+
+/**
+ * @brief Primitives sharing a mode, texture and clipping frame, submitted with a single draw call.
+ */
+typedef struct {
+
+	/**
+	 * @brief The vertices.
+	 */
+	RendererVertex *vertices;
+
+	/**
+	 * @brief The count of vertices.
+	 */
+	size_t count;
+
+	/**
+	 * @brief The capacity of `vertices`.
+	 */
+	size_t capacity;
+
+	/**
+	 * @brief The primitive mode, `GL_LINES` or `GL_QUADS`.
+	 */
+	GLenum mode;
+
+	/**
+	 * @brief The texture, or `0` for untextured primitives.
+	 */
+	GLuint texture;
+} RendererBatch;
+
+/**
+ * @brief Per-frame Renderer statistics.
+ */
+typedef struct {
+
+	/**
+	 * @brief The count of draw calls submitted to OpenGL.
+	 */
+	unsigned int drawCalls;
+
+	/**
+	 * @brief The count of vertices submitted to OpenGL.
+	 */
+	unsigned int vertices;
+
+	/**
+	 * @brief The count of textures uploaded via Renderer::createTexture.
+	 */
+	unsigned int textureUploads;
+
+	/**
+	 * @brief The count of scissor rectangle changes.
+	 */
+	unsigned int scissorChanges;
+
+	/**
+	 * @brief The count of Views rendered, including layer-backed Views drawn from their layer.
+	 */
+	unsigned int viewsDrawn;
+
+	/**
+	 * @brief The count of Views skipped because they were clipped or outside of the damage.
+	 */
+	unsigned int viewsCulled;
+
+	/**
+	 * @brief The count of glyphs rasterized into Font atlases.
+	 */
+	unsigned int glyphsRasterized;
+
+	/**
+	 * @brief The GPU time, in milliseconds, of the most recent frame for which a timer query has
+	 * completed, or `0` if Renderer::timerQueries is not enabled or not supported.
+	 * @remarks Timer query results lag the CPU by one or more frames.
+	 */
+	double gpuTime;
+} RendererStats;
+
 /**
  * @brief The Renderer is responsible for rasterizing the View hierarchy of a WindowController.
  * @details This class provides an OpenGL 1.x implementation of the RendererInterface. Applications
  * may extend this class and provide an implementation that meets their own OpenGL version
- * requirements.
+ * requirements. See CoreRenderer for an OpenGL 3.3 core profile implementation.
+ * @details Primitives are accumulated into a client-side vertex array, and submitted with one draw
+ * call per run of primitives sharing the same mode, texture and clipping frame.
  * @extends Object
  */
 struct Renderer {
@@ -59,6 +161,155 @@ struct Renderer {
 	 * @protected
 	 */
 	RendererInterface *interface;
+
+	/**
+	 * @brief A copy of the previous frame, used to restore undamaged regions of the back buffer.
+	 * @private
+	 */
+	GLuint backBuffer;
+
+	/**
+	 * @brief The size of `backBuffer`, in drawable pixels.
+	 * @private
+	 */
+	SDL_Size backBufferSize;
+
+	/**
+	 * @brief The pending primitives.
+	 * @private
+	 */
+	RendererBatch batch;
+
+	/**
+	 * @brief If true, primitives are batched until the texture or clipping frame changes, or until
+	 * the end of the frame. If false, each primitive is submitted immediately.
+	 * @remarks Views that issue OpenGL calls directly should call Renderer::flush first.
+	 */
+	_Bool batching;
+
+	/**
+	 * @brief The region of the window, in object space, redrawn by the current frame.
+	 * @remarks Views that do not intersect this region are not drawn.
+	 * @see Renderer::setDamage
+	 */
+	SDL_Rect damage;
+
+	/**
+	 * @brief The current draw color.
+	 * @private
+	 */
+	SDL_Color drawColor;
+
+	/**
+	 * @brief The metrics of the window being rendered, resolved once per frame in
+	 * Renderer::beginFrame.
+	 */
+	struct {
+
+		/**
+		 * @brief The window.
+		 */
+		SDL_Window *window;
+
+		/**
+		 * @brief The window size, in object space.
+		 */
+		SDL_Size size;
+
+		/**
+		 * @brief The drawable size, in pixels.
+		 */
+		SDL_Size drawableSize;
+
+		/**
+		 * @brief The ratio of drawable pixels to object space units.
+		 * @see MVC_WindowScale(SDL_Window *, int *, int *)
+		 */
+		double scale;
+	} metrics;
+
+	/**
+	 * @brief If true, only the damaged region of the window is redrawn each frame, and the rest of
+	 * the back buffer is restored from a copy of the previous frame.
+	 * @remarks This requires that the View hierarchy own the entire window: anything drawn by the
+	 * application before WindowController::render is overwritten. The default is false.
+	 */
+	_Bool partialRedraw;
+
+	/**
+	 * @brief The current scissor rectangle, in window coordinates.
+	 * @private
+	 */
+	SDL_Rect scissor;
+
+	/**
+	 * @brief The statistics of the current frame.
+	 * @remarks These are reset by Renderer::beginFrame, and are complete after Renderer::endFrame.
+	 */
+	RendererStats stats;
+
+	/**
+	 * @brief A shadow copy of the OpenGL state managed by this Renderer, so that only changes
+	 * reach the driver.
+	 * @remarks The shadow is reset by Renderer::beginFrame. Views that change this state directly
+	 * from View::render must restore it before returning.
+	 * @private
+	 */
+	struct {
+
+		/**
+		 * @brief The texture bound to `GL_TEXTURE_2D`.
+		 */
+		GLuint texture;
+
+		/**
+		 * @brief True if `GL_TEXTURE_2D` is enabled.
+		 */
+		_Bool texture2D;
+
+		/**
+		 * @brief True if the client-side vertex arrays are enabled.
+		 */
+		_Bool vertexArrays;
+	} state;
+
+	/**
+	 * @brief If true, the GPU time of each frame is measured with timer queries, when supported.
+	 * @see RendererStats::gpuTime
+	 */
+	_Bool timerQueries;
+
+	/**
+	 * @brief The timer query state.
+	 * @private
+	 */
+	struct {
+
+		/**
+		 * @brief True if a query is in progress for the current frame.
+		 */
+		_Bool active;
+
+		/**
+		 * @brief The query objects, used in alternating frames.
+		 */
+		GLuint queries[2];
+
+		/**
+		 * @brief True for each query that has been issued but not yet read.
+		 */
+		_Bool pending[2];
+
+		/**
+		 * @brief The index of the query for the current frame.
+		 */
+		int index;
+
+		/**
+		 * @brief The most recent GPU time, in milliseconds.
+		 */
+		double gpuTime;
+	} timer;
 };
 
 /**
@@ -92,57 +343,92 @@ struct RendererInterface {
 	GLuint (*createTexture)(const Renderer *self, const SDL_Surface *surface);
 
 	/**
-	 * @fn void Renderer::drawLine(const Renderer *self, const SDL_Point *points)
-	 * @brief Draws a line segment between two points using `GL_LINE_STRIP`.
+	 * @fn GLuint Renderer::createTextureWithFramebuffer(Renderer *self, const SDL_Rect *rect)
+	 * @brief Generates an OpenGL texture object from a region of the framebuffer.
+	 * @param self The Renderer.
+	 * @param rect The region, in object space.
+	 * @return The OpenGL texture name, or `0` on error.
+	 * @remarks Pending primitives are flushed first, so that the region reflects all drawing
+	 * performed so far this frame.
+	 * @memberof Renderer
+	 */
+	GLuint (*createTextureWithFramebuffer)(Renderer *self, const SDL_Rect *rect);
+
+	/**
+	 * @fn void Renderer::deleteTexture(Renderer *self, GLuint texture)
+	 * @brief Deletes a texture created by this Renderer.
+	 * @param self The Renderer.
+	 * @param texture The texture name, or `0`.
+	 * @remarks Pending primitives are flushed first, as they may sample the texture.
+	 * @memberof Renderer
+	 */
+	void (*deleteTexture)(Renderer *self, GLuint texture);
+
+	/**
+	 * @fn void Renderer::drawLine(Renderer *self, const SDL_Point *points)
+	 * @brief Draws a line segment between two points.
 	 * @param self The Renderer.
 	 * @param points The points.
 	 * @memberof Renderer
 	 */
-	void (*drawLine)(const Renderer *self, const SDL_Point *points);
+	void (*drawLine)(Renderer *self, const SDL_Point *points);
 
 	/**
-	 * @fn void Renderer::drawLines(const Renderer *self, const SDL_Point *points, size_t count)
-	 * @brief Draws line segments between adjacent points using `GL_LINE_STRIP`.
+	 * @fn void Renderer::drawLines(Renderer *self, const SDL_Point *points, size_t count)
+	 * @brief Draws line segments between adjacent points.
 	 * @param self The Renderer.
 	 * @param points The points.
 	 * @param count The length of points.
 	 * @memberof Renderer
 	 */
-	void (*drawLines)(const Renderer *self, const SDL_Point *points, size_t count);
+	void (*drawLines)(Renderer *self, const SDL_Point *points, size_t count);
 
 	/**
-	 * @fn void Renderer::drawRect(const Renderer *self, const SDL_Rect *rect)
-	 * @brief Draws a rectangle using `GL_LINE_LOOP`.
+	 * @fn void Renderer::drawRect(Renderer *self, const SDL_Rect *rect)
+	 * @brief Draws the outline of a rectangle.
 	 * @param self The Renderer.
 	 * @param rect The rectangle.
 	 * @memberof Renderer
 	 */
-	void (*drawRect)(const Renderer *self, const SDL_Rect *rect);
+	void (*drawRect)(Renderer *self, const SDL_Rect *rect);
 
 	/**
-	 * @fn void Renderer::drawRectFilled(const Renderer *self, const SDL_Rect *rect)
-	 * @brief Fills a rectangle using `glRecti`.
+	 * @fn void Renderer::drawRectFilled(Renderer *self, const SDL_Rect *rect)
+	 * @brief Fills a rectangle.
 	 * @param self The Renderer.
 	 * @param rect The rectangle.
 	 * @memberof Renderer
 	 */
-	void (*drawRectFilled)(const Renderer *self, const SDL_Rect *rect);
+	void (*drawRectFilled)(Renderer *self, const SDL_Rect *rect);
 
 	/**
-	 * @fn void Renderer::drawTexture(const Renderer *self, GLuint texture, const SDL_Rect *dest)
-	 * @brief Draws a textured `GL_QUAD` in the given rectangle.
+	 * @fn void Renderer::drawTexture(Renderer *self, GLuint texture, const SDL_Rect *dest)
+	 * @brief Draws a textured quad in the given rectangle.
 	 * @param self The Renderer.
 	 * @param texture The texture.
 	 * @param dest The destination in screen coordinates.
 	 * @memberof Renderer
 	 */
-	void (*drawTexture)(const Renderer *self, GLuint texture, const SDL_Rect *dest);
+	void (*drawTexture)(Renderer *self, GLuint texture, const SDL_Rect *dest);
+
+	/**
+	 * @fn void Renderer::drawTextureRegion(Renderer *self, GLuint texture, const GLfloat *texcoords, const SDL_Rect *dest)
+	 * @brief Draws a region of the given texture in the given rectangle.
+	 * @param self The Renderer.
+	 * @param texture The texture.
+	 * @param texcoords The normalized texture coordinates of the region, `{ s0, t0, s1, t1 }`.
+	 * @param dest The destination in screen coordinates.
+	 * @memberof Renderer
+	 */
+	void (*drawTextureRegion)(Renderer *self, GLuint texture, const GLfloat *texcoords, const SDL_Rect *dest);
 
 	/**
 	 * @fn void Renderer::drawView(Renderer *self, View *view)
 	 * @brief Draws the given View, setting the clipping frame and invoking View::render.
 	 * @param self The Renderer.
 	 * @param view The View.
+	 * @remarks View::drawWithClip sets the clipping frame it carries down the View hierarchy
+	 * directly, unless this method is overridden.
 	 * @memberof Renderer
 	 */
 	void (*drawView)(Renderer *self, View *view);
@@ -157,6 +443,16 @@ struct RendererInterface {
 	 */
 	void (*endFrame)(Renderer *self);
 
+	/**
+	 * @fn void Renderer::flush(Renderer *self)
+	 * @brief Submits all batched primitives to OpenGL.
+	 * @param self The Renderer.
+	 * @remarks This method is called automatically when the texture or clipping frame changes, and
+	 * by Renderer::endFrame. Call it explicitly before issuing OpenGL commands from View::render.
+	 * @memberof Renderer
+	 */
+	void (*flush)(Renderer *self);
+
 	/**
 	 * @protected
 	 * @fn Renderer *Renderer::init(Renderer *self)
@@ -167,10 +463,20 @@ struct RendererInterface {
 	 */
 	Renderer *(*init)(Renderer *self);
 
+	/**
+	 * @fn GLint Renderer::maxTextureSize(const Renderer *self)
+	 * @param self The Renderer.
+	 * @return The maximum width and height, in pixels, of textures created by this Renderer.
+	 * @memberof Renderer
+	 */
+	GLint (*maxTextureSize)(const Renderer *self);
+
 	/**
 	 * @fn void Renderer::renderDeviceDidReset(Renderer *self)
 	 * @brief This method is invoked when the render context is invalidated.
 	 * @param self The Renderer.
+	 * @remarks The textures of all Images uploaded via this Renderer are discarded.
+	 * @see Image::resetTextures(const Renderer *)
 	 * @memberof Renderer
 	 */
 	void (*renderDeviceDidReset)(Renderer *self);
@@ -185,6 +491,17 @@ struct RendererInterface {
 	 */
 	void (*setClippingFrame)(Renderer *self, const SDL_Rect *clippingFrame);
 
+	/**
+	 * @fn void Renderer::setDamage(Renderer *self, const SDL_Rect *damage)
+	 * @brief Sets the region of the window to be redrawn by the next frame.
+	 * @param self The Renderer.
+	 * @param damage The damaged region, in object space, or `NULL` for the entire window.
+	 * @remarks This method is called by the WindowController before Renderer::beginFrame. The
+	 * damage is reset to the entire window by Renderer::endFrame.
+	 * @memberof Renderer
+	 */
+	void (*setDamage)(Renderer *self, const SDL_Rect *damage);
+
 	/**
 	 * @fn void Renderer::setDrawColor(Renderer *self, const SDL_Color *color)
 	 * @brief Sets the primary color for drawing operations.
@@ -193,6 +510,18 @@ struct RendererInterface {
 	 * @memberof Renderer
 	 */
 	void (*setDrawColor)(Renderer *self, const SDL_Color *color);
+
+	/**
+	 * @fn void Renderer::updateTexture(Renderer *self, GLuint texture, const SDL_Surface *surface, const SDL_Rect *rect)
+	 * @brief Uploads a region of the given surface to a texture created from it by this Renderer.
+	 * @param self The Renderer.
+	 * @param texture The texture.
+	 * @param surface The surface, whose size and format must match those of `texture`.
+	 * @param rect The region, in pixels.
+	 * @remarks Pending primitives are flushed first, as they may sample the texture.
+	 * @memberof Renderer
+	 */
+	void (*updateTexture)(Renderer *self, GLuint texture, const SDL_Surface *surface, const SDL_Rect *rect);
 };
 
 /**
@@ -0,0 +1,143 @@
+/*
+ * ObjectivelyMVC: MVC framework for OpenGL and SDL2 in c.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <ObjectivelyMVC/RendererStatsView.h>
+
+#define _Class _RendererStatsView
+
+#pragma mark - View
+
+/**
+ * @see View::init(View *)
+ */
+static View *init(View *self) {
+	return (View *) $((RendererStatsView *) self, initWithFrame, NULL);
+}
+
+#pragma mark - RendererStatsView
+
+/**
+ * @fn RendererStatsView *RendererStatsView::initWithFrame(RendererStatsView *self, const SDL_Rect *frame)
+ * @memberof RendererStatsView
+ */
+static RendererStatsView *initWithFrame(RendererStatsView *self, const SDL_Rect *frame) {
+
+	self = (RendererStatsView *) super(Label, self, initWithText, NULL, NULL);
+	if (self) {
+
+		View *view = (View *) self;
+
+		if (frame) {
+			view->frame = *frame;
+		}
+
+		view->backgroundColor = MakeColor(0, 0, 0, 192);
+
+		view->padding.top = view->padding.bottom = DEFAULT_RENDERER_STATS_VIEW_PADDING;
+		view->padding.left = view->padding.right = DEFAULT_RENDERER_STATS_VIEW_PADDING;
+	}
+
+	return self;
+}
+
+/**
+ * @fn void RendererStatsView::updateStats(RendererStatsView *self, const RendererStats *stats, const SDL_Rect *damage)
+ * @memberof RendererStatsView
+ */
+static void updateStats(RendererStatsView *self, const RendererStats *stats, const SDL_Rect *damage) {
+
+	if (SDL_RectEmpty(&self->damage) == false) {
+
+		const SDL_Rect frame = $((View *) self, clippingFrame);
+
+		SDL_Rect own, rect;
+		SDL_UnionRect(&self->damage, &frame, &own);
+		SDL_UnionRect(&own, damage, &rect);
+
+		self->damage = MakeRect(0, 0, 0, 0);
+
+		if (SDL_RectEquals(&rect, &own)) {
+			return;
+		}
+	}
+
+	if (memcmp(stats, &self->stats, sizeof(*stats))) {
+		self->stats = *stats;
+
+		char text[256];
+		snprintf(text, sizeof(text),
+				 "%u draws, %u vertices, %u uploads, %u scissors, %u/%u views, %u glyphs, %.2fms GPU",
+				 stats->drawCalls,
+				 stats->vertices,
+				 stats->textureUploads,
+				 stats->scissorChanges,
+				 stats->viewsDrawn,
+				 stats->viewsDrawn + stats->viewsCulled,
+				 stats->glyphsRasterized,
+				 stats->gpuTime);
+
+		$(self->label.text, setText, text);
+
+		self->damage = $((View *) self, clippingFrame);
+	}
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	((ViewInterface *) clazz->def->interface)->init = init;
+
+	((RendererStatsViewInterface *) clazz->def->interface)->initWithFrame = initWithFrame;
+	((RendererStatsViewInterface *) clazz->def->interface)->updateStats = updateStats;
+}
+
+/**
+ * @fn Class *RendererStatsView::_RendererStatsView(void)
+ * @memberof RendererStatsView
+ */
+Class *_RendererStatsView(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "RendererStatsView";
+		clazz.superclass = _Label();
+		clazz.instanceSize = sizeof(RendererStatsView);
+		clazz.interfaceOffset = offsetof(RendererStatsView, interface);
+		clazz.interfaceSize = sizeof(RendererStatsViewInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
@@ -0,0 +1,112 @@
+/*
+ * ObjectivelyMVC: MVC framework for OpenGL and SDL2 in c.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+
+#pragma once
+
+#include <ObjectivelyMVC/Label.h>
+
+/**
+ * @file
+ * @brief A Label displaying Renderer statistics.
+ */
+
+#define DEFAULT_RENDERER_STATS_VIEW_PADDING 4
+
+typedef struct RendererStatsView RendererStatsView;
+typedef struct RendererStatsViewInterface RendererStatsViewInterface;
+
+/**
+ * @brief A Label displaying the RendererStats of the previous frame.
+ * @details Add this View to the top of the View hierarchy to monitor draw calls, texture uploads,
+ * scissor changes, culling, glyph rasterization and GPU time as the application runs.
+ * @remarks Assign this View to WindowController::rendererStatsView to have it refreshed after
+ * each frame. Frames that redraw only this View are not reported, so that displaying the
+ * statistics does not itself produce a stream of new frames.
+ * @extends Label
+ */
+struct RendererStatsView {
+
+	/**
+	 * @brief The superclass.
+	 */
+	Label label;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	RendererStatsViewInterface *interface;
+
+	/**
+	 * @brief The region, in object space, damaged by the most recent refresh of this View.
+	 * @private
+	 */
+	SDL_Rect damage;
+
+	/**
+	 * @brief The statistics currently displayed.
+	 * @private
+	 */
+	RendererStats stats;
+};
+
+/**
+ * @brief The RendererStatsView interface.
+ */
+struct RendererStatsViewInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	LabelInterface labelInterface;
+
+	/**
+	 * @fn RendererStatsView *RendererStatsView::initWithFrame(RendererStatsView *self, const SDL_Rect *frame)
+	 * @brief Initializes this RendererStatsView with the given frame.
+	 * @param self The RendererStatsView.
+	 * @param frame The frame, or `NULL`.
+	 * @return The initialized RendererStatsView, or `NULL` on error.
+	 * @memberof RendererStatsView
+	 */
+	RendererStatsView *(*initWithFrame)(RendererStatsView *self, const SDL_Rect *frame);
+
+	/**
+	 * @fn void RendererStatsView::updateStats(RendererStatsView *self, const RendererStats *stats, const SDL_Rect *damage)
+	 * @brief Displays the given RendererStats, unless the frame they describe redrew only this View.
+	 * @param self The RendererStatsView.
+	 * @param stats The RendererStats of the frame that was just rendered.
+	 * @param damage The region, in object space, that the frame redrew.
+	 * @remarks This method is called by WindowController::render after Renderer::endFrame.
+	 * @memberof RendererStatsView
+	 */
+	void (*updateStats)(RendererStatsView *self, const RendererStats *stats, const SDL_Rect *damage);
+};
+
+/**
+ * @fn Class *RendererStatsView::_RendererStatsView(void)
+ * @brief The RendererStatsView archetype.
+ * @return The RendererStatsView Class.
+ * @memberof RendererStatsView
+ */
+OBJECTIVELYMVC_EXPORT Class *_RendererStatsView(void);
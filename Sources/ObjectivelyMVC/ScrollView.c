@@ -117,6 +117,8 @@ static ScrollView *initWithFrame(ScrollView *self, const SDL_Rect *frame, Contro
  */
 static void scrollToOffset(ScrollView *self, const SDL_Point *offset) {
 
+	const SDL_Point contentOffset = self->contentOffset;
+
 	if (self->contentView) {
 		const SDL_Size contentSize = $(self->contentView, size);
 		const SDL_Rect bounds = $((View *) self, bounds);
@@ -137,7 +139,13 @@ static void scrollToOffset(ScrollView *self, const SDL_Point *offset) {
 		self->contentOffset.x = self->contentOffset.y = 0;
 	}
 
-	self->control.view.needsLayout = true;
+	$((View *) self, setNeedsLayout);
+
+	if (self->contentOffset.x != contentOffset.x || self->contentOffset.y != contentOffset.y) {
+		if (self->delegate.didScroll) {
+			self->delegate.didScroll(self);
+		}
+	}
 }
 
 /**
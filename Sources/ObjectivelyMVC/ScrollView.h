@@ -82,6 +82,11 @@ struct ScrollView {
 	 */
 	View *contentView;
 
+	/**
+	 * @brief The delegate.
+	 */
+	ScrollViewDelegate delegate;
+
 	/**
 	 * @brief The scroll step, in pixels.
 	 */
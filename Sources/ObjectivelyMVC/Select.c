@@ -180,7 +180,7 @@ static void stateDidChange(Control *self) {
 	
 	super(Control, self, stateDidChange);
 
-	((View *) self)->needsLayout = true;
+	$((View *) self, setNeedsLayout);
 }
 
 #pragma mark - Select
@@ -222,7 +222,7 @@ static void addOption(Select *self, const char *title, ident value) {
 		self->selectedOption = option;
 	}
 
-	self->control.view.needsLayout = true;
+	$((View *) self, setNeedsLayout);
 
 	release(option);
 }
@@ -299,7 +299,7 @@ static void removeAllOptions(Select *self) {
 
 	self->selectedOption = NULL;
 
-	self->control.view.needsLayout = true;
+	$((View *) self, setNeedsLayout);
 }
 
 /**
@@ -316,7 +316,7 @@ static void removeOption(Select *self, Option *option) {
 
 	$((View *) option, removeFromSuperview);
 
-	self->control.view.needsLayout = true;
+	$((View *) self, setNeedsLayout);
 }
 
 /**
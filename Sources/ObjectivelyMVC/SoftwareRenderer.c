@@ -0,0 +1,526 @@
+/*
+ * ObjectivelyMVC: MVC framework for OpenGL and SDL2 in c.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <ObjectivelyMVC/Colors.h>
+#include <ObjectivelyMVC/Log.h>
+#include <ObjectivelyMVC/SoftwareRenderer.h>
+#include <ObjectivelyMVC/Trace.h>
+
+#define _Class _SoftwareRenderer
+
+#pragma mark - Object
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	SoftwareRenderer *this = (SoftwareRenderer *) self;
+
+	for (size_t i = 0; i < this->textureCount; i++) {
+		free(this->textures[i].pixels);
+	}
+
+	free(this->textures);
+
+	SDL_FreeSurface(this->surface);
+
+	super(Object, self, dealloc);
+}
+
+#pragma mark - Renderer
+
+/**
+ * @return The bounds of the surface.
+ */
+static SDL_Rect surfaceFrame(const SoftwareRenderer *self) {
+	return MakeRect(0, 0, self->surface->w, self->surface->h);
+}
+
+/**
+ * @brief Blends the given source pixel over the destination pixel, as
+ * `glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA)` would.
+ */
+static inline void blendPixel(Uint8 *dest, const Uint8 *src) {
+
+	const int a = src[3];
+
+	if (a == 255) {
+		memcpy(dest, src, 4);
+	} else if (a) {
+		for (int i = 0; i < 4; i++) {
+			dest[i] = (src[i] * a + dest[i] * (255 - a) + 127) / 255;
+		}
+	}
+}
+
+/**
+ * @return The address of the given pixel of the surface.
+ */
+static inline Uint8 *pixelAt(const SoftwareRenderer *self, int x, int y) {
+	return (Uint8 *) self->surface->pixels + y * self->surface->pitch + x * 4;
+}
+
+/**
+ * @brief Rasterizes the line segment between the given vertices, excluding the last pixel.
+ */
+static void rasterizeLine(SoftwareRenderer *self, const RendererVertex *a, const RendererVertex *b) {
+
+	const Uint8 src[] = { a->color.r, a->color.g, a->color.b, a->color.a };
+
+	const int dx = abs(b->x - a->x), sx = a->x < b->x ? 1 : -1;
+	const int dy = -abs(b->y - a->y), sy = a->y < b->y ? 1 : -1;
+
+	int x = a->x, y = a->y, err = dx + dy;
+
+	while (x != b->x || y != b->y) {
+
+		const SDL_Point point = MakePoint(x, y);
+		if (SDL_PointInRect(&point, &self->clip)) {
+			blendPixel(pixelAt(self, x, y), src);
+		}
+
+		const int e2 = 2 * err;
+		if (e2 >= dy) {
+			err += dy;
+			x += sx;
+		}
+		if (e2 <= dx) {
+			err += dx;
+			y += sy;
+		}
+	}
+}
+
+/**
+ * @brief Rasterizes the axis-aligned quad with the given vertices, sampling `texture` if not `NULL`.
+ */
+static void rasterizeQuad(SoftwareRenderer *self, const RendererVertex *v, const SoftwareTexture *texture) {
+
+	const SDL_Rect quad = MakeRect(min(v[0].x, v[2].x), min(v[0].y, v[2].y), abs(v[2].x - v[0].x), abs(v[2].y - v[0].y));
+
+	SDL_Rect rect;
+	if (SDL_IntersectRect(&quad, &self->clip, &rect) == false) {
+		return;
+	}
+
+	const SDL_Color color = v->color;
+
+	if (texture == NULL) {
+
+		const Uint8 src[] = { color.r, color.g, color.b, color.a };
+
+		for (int y = rect.y; y < rect.y + rect.h; y++) {
+			Uint8 *dest = pixelAt(self, rect.x, y);
+			for (int x = 0; x < rect.w; x++, dest += 4) {
+				blendPixel(dest, src);
+			}
+		}
+
+		return;
+	}
+
+	const double ds = (v[2].s - v[0].s) / (v[2].x - v[0].x);
+	const double dt = (v[2].t - v[0].t) / (v[2].y - v[0].y);
+
+	for (int y = rect.y; y < rect.y + rect.h; y++) {
+
+		const double t = v[0].t + (y + 0.5 - v[0].y) * dt;
+		const int ty = clamp((int) (t * texture->h), 0, texture->h - 1);
+
+		Uint8 *dest = pixelAt(self, rect.x, y);
+
+		for (int x = rect.x; x < rect.x + rect.w; x++, dest += 4) {
+
+			const double s = v[0].s + (x + 0.5 - v[0].x) * ds;
+			const int tx = clamp((int) (s * texture->w), 0, texture->w - 1);
+
+			const Uint8 *texel = texture->pixels + (ty * texture->w + tx) * 4;
+
+			const Uint8 src[] = {
+				(texel[0] * color.r + 127) / 255,
+				(texel[1] * color.g + 127) / 255,
+				(texel[2] * color.b + 127) / 255,
+				(texel[3] * color.a + 127) / 255
+			};
+
+			blendPixel(dest, src);
+		}
+	}
+}
+
+/**
+ * @brief Copies a region of the given surface to the texture, converting it to RGBA.
+ */
+static void copyTexturePixels(SoftwareTexture *texture, const SDL_Surface *surface, const SDL_Rect *rect) {
+
+	const int bytesPerPixel = surface->format->BytesPerPixel;
+
+	for (int y = rect->y; y < rect->y + rect->h; y++) {
+
+		const Uint8 *in = (Uint8 *) surface->pixels + y * surface->pitch + rect->x * bytesPerPixel;
+		Uint8 *out = texture->pixels + (y * texture->w + rect->x) * 4;
+
+		switch (bytesPerPixel) {
+			case 1:
+				for (int x = 0; x < rect->w; x++, in++, out += 4) {
+					out[0] = out[1] = out[2] = in[0];
+					out[3] = 255;
+				}
+				break;
+			case 3:
+				for (int x = 0; x < rect->w; x++, in += 3, out += 4) {
+					memcpy(out, in, 3);
+					out[3] = 255;
+				}
+				break;
+			case 4:
+				memcpy(out, in, rect->w * 4);
+				break;
+		}
+	}
+}
+
+/**
+ * @see Renderer::beginFrame(Renderer *)
+ */
+static void beginFrame(Renderer *self) {
+
+	SoftwareRenderer *this = (SoftwareRenderer *) self;
+
+	MVC_TraceBegin("beginFrame");
+
+	memset(&self->stats, 0, sizeof(self->stats));
+
+	self->metrics.window = NULL;
+	self->metrics.size = MakeSize(this->surface->w, this->surface->h);
+	self->metrics.drawableSize = self->metrics.size;
+	self->metrics.scale = 1.0;
+
+	self->batch.count = 0;
+
+	this->clip = surfaceFrame(this);
+
+	$(self, setDrawColor, &Colors.White);
+
+	if (self->partialRedraw == false) {
+		self->damage = surfaceFrame(this);
+	}
+
+	SDL_Rect damage;
+	if (SDL_IntersectRect(&self->damage, &this->clip, &damage)) {
+		SDL_FillRect(this->surface, &damage, 0);
+	}
+
+	MVC_TraceEnd("beginFrame");
+}
+
+/**
+ * @see Renderer::createTexture(const Renderer *, const SDL_Surface *)
+ */
+static GLuint createTexture(const Renderer *self, const SDL_Surface *surface) {
+
+	SoftwareRenderer *this = (SoftwareRenderer *) self;
+
+	assert(surface);
+
+	const int bytesPerPixel = surface->format->BytesPerPixel;
+	switch (bytesPerPixel) {
+		case 1:
+		case 3:
+		case 4:
+			break;
+		default:
+			MVC_LogError("Invalid surface format: %s\n", SDL_GetPixelFormatName(surface->format->format));
+			return 0;
+	}
+
+	GLuint name = this->freeTextures;
+	if (name) {
+		this->freeTextures = this->textures[name - 1].next;
+	} else {
+		if (this->textureCount == this->textureCapacity) {
+
+			this->textureCapacity = this->textureCapacity ? this->textureCapacity * 2 : 16;
+
+			this->textures = realloc(this->textures, this->textureCapacity * sizeof(SoftwareTexture));
+			assert(this->textures);
+		}
+
+		name = (GLuint) ++this->textureCount;
+	}
+
+	SoftwareTexture *texture = &this->textures[name - 1];
+	texture->next = 0;
+
+	texture->w = surface->w;
+	texture->h = surface->h;
+	texture->pixels = malloc(texture->w * texture->h * 4);
+	assert(texture->pixels);
+
+	copyTexturePixels(texture, surface, &MakeRect(0, 0, surface->w, surface->h));
+
+	this->renderer.stats.textureUploads++;
+
+	return name;
+}
+
+/**
+ * @see Renderer::createTextureWithFramebuffer(Renderer *, const SDL_Rect *)
+ */
+static GLuint createTextureWithFramebuffer(Renderer *self, const SDL_Rect *rect) {
+
+	$(self, flush);
+
+	return 0;
+}
+
+/**
+ * @see Renderer::deleteTexture(Renderer *, GLuint)
+ */
+static void deleteTexture(Renderer *self, GLuint texture) {
+
+	SoftwareRenderer *this = (SoftwareRenderer *) self;
+
+	if (texture == 0 || texture > this->textureCount || this->textures[texture - 1].pixels == NULL) {
+		return;
+	}
+
+	$(self, flush);
+
+	SoftwareTexture *t = &this->textures[texture - 1];
+
+	free(t->pixels);
+	t->pixels = NULL;
+
+	t->next = this->freeTextures;
+	this->freeTextures = texture;
+}
+
+/**
+ * @see Renderer::endFrame(Renderer *)
+ */
+static void endFrame(Renderer *self) {
+
+	SoftwareRenderer *this = (SoftwareRenderer *) self;
+
+	MVC_TraceBegin("endFrame");
+
+	$(self, flush);
+
+	self->damage = surfaceFrame(this);
+
+	$(self, setDrawColor, &Colors.White);
+
+	this->clip = surfaceFrame(this);
+
+	MVC_TraceEnd("endFrame");
+}
+
+/**
+ * @see Renderer::flush(Renderer *)
+ */
+static void flush(Renderer *self) {
+
+	SoftwareRenderer *this = (SoftwareRenderer *) self;
+
+	RendererBatch *batch = &self->batch;
+
+	if (batch->count == 0) {
+		return;
+	}
+
+	const SoftwareTexture *texture = NULL;
+	if (batch->texture && batch->texture <= this->textureCount && this->textures[batch->texture - 1].pixels) {
+		texture = &this->textures[batch->texture - 1];
+	}
+
+	const RendererVertex *v = batch->vertices;
+
+	switch (batch->mode) {
+		case GL_LINES:
+			for (size_t i = 0; i + 1 < batch->count; i += 2) {
+				rasterizeLine(this, &v[i], &v[i + 1]);
+			}
+			break;
+		case GL_QUADS:
+			for (size_t i = 0; i + 3 < batch->count; i += 4) {
+				rasterizeQuad(this, &v[i], texture);
+			}
+			break;
+		default:
+			MVC_LogError("Unsupported primitive mode: %d\n", batch->mode);
+			break;
+	}
+
+	self->stats.drawCalls++;
+	self->stats.vertices += batch->count;
+
+	batch->count = 0;
+}
+
+/**
+ * @see Renderer::maxTextureSize(const Renderer *)
+ */
+static GLint maxTextureSize(const Renderer *self) {
+	return SOFTWARE_RENDERER_MAX_TEXTURE_SIZE;
+}
+
+/**
+ * @see Renderer::setClippingFrame(Renderer *, const SDL_Rect *)
+ */
+static void setClippingFrame(Renderer *self, const SDL_Rect *clippingFrame) {
+
+	SoftwareRenderer *this = (SoftwareRenderer *) self;
+
+	const SDL_Rect frame = surfaceFrame(this);
+
+	SDL_Rect clip = frame;
+	if (clippingFrame) {
+
+		const SDL_Rect rect = MakeRect(clippingFrame->x - 1, clippingFrame->y, clippingFrame->w + 1, clippingFrame->h + 1);
+		if (SDL_IntersectRect(&rect, &frame, &clip) == false) {
+			clip = MakeRect(0, 0, 0, 0);
+		}
+	}
+
+	if (SDL_RectEquals(&clip, &this->clip) == false) {
+
+		$(self, flush);
+
+		self->stats.scissorChanges++;
+
+		this->clip = clip;
+	}
+}
+
+/**
+ * @see Renderer::setDamage(Renderer *, const SDL_Rect *)
+ */
+static void setDamage(Renderer *self, const SDL_Rect *damage) {
+
+	if (damage) {
+		self->damage = *damage;
+	} else {
+		self->damage = surfaceFrame((SoftwareRenderer *) self);
+	}
+}
+
+/**
+ * @see Renderer::updateTexture(Renderer *, GLuint, const SDL_Surface *, const SDL_Rect *)
+ */
+static void updateTexture(Renderer *self, GLuint texture, const SDL_Surface *surface, const SDL_Rect *rect) {
+
+	SoftwareRenderer *this = (SoftwareRenderer *) self;
+
+	assert(surface);
+	assert(rect);
+
+	if (texture == 0 || texture > this->textureCount || this->textures[texture - 1].pixels == NULL) {
+		return;
+	}
+
+	SoftwareTexture *t = &this->textures[texture - 1];
+	assert(t->w == surface->w && t->h == surface->h);
+
+	$(self, flush);
+
+	copyTexturePixels(t, surface, rect);
+}
+
+#pragma mark - SoftwareRenderer
+
+/**
+ * @fn SoftwareRenderer *SoftwareRenderer::initWithSize(SoftwareRenderer *self, const SDL_Size *size)
+ * @memberof SoftwareRenderer
+ */
+static SoftwareRenderer *initWithSize(SoftwareRenderer *self, const SDL_Size *size) {
+
+	assert(size);
+
+	self = (SoftwareRenderer *) super(Renderer, self, init);
+	if (self) {
+
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+		self->surface = SDL_CreateRGBSurface(0, size->w, size->h, 32, 0x000000ff, 0x0000ff00, 0x00ff0000, 0xff000000);
+#else
+		self->surface = SDL_CreateRGBSurface(0, size->w, size->h, 32, 0xff000000, 0x00ff0000, 0x0000ff00, 0x000000ff);
+#endif
+		assert(self->surface);
+
+		self->clip = surfaceFrame(self);
+		self->renderer.damage = surfaceFrame(self);
+	}
+
+	return self;
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	((ObjectInterface *) clazz->def->interface)->dealloc = dealloc;
+
+	((RendererInterface *) clazz->def->interface)->beginFrame = beginFrame;
+	((RendererInterface *) clazz->def->interface)->createTexture = createTexture;
+	((RendererInterface *) clazz->def->interface)->createTextureWithFramebuffer = createTextureWithFramebuffer;
+	((RendererInterface *) clazz->def->interface)->deleteTexture = deleteTexture;
+	((RendererInterface *) clazz->def->interface)->endFrame = endFrame;
+	((RendererInterface *) clazz->def->interface)->flush = flush;
+	((RendererInterface *) clazz->def->interface)->maxTextureSize = maxTextureSize;
+	((RendererInterface *) clazz->def->interface)->setClippingFrame = setClippingFrame;
+	((RendererInterface *) clazz->def->interface)->setDamage = setDamage;
+	((RendererInterface *) clazz->def->interface)->updateTexture = updateTexture;
+
+	((SoftwareRendererInterface *) clazz->def->interface)->initWithSize = initWithSize;
+}
+
+/**
+ * @fn Class *SoftwareRenderer::_SoftwareRenderer(void)
+ * @memberof SoftwareRenderer
+ */
+Class *_SoftwareRenderer(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "SoftwareRenderer";
+		clazz.superclass = _Renderer();
+		clazz.instanceSize = sizeof(SoftwareRenderer);
+		clazz.interfaceOffset = offsetof(SoftwareRenderer, interface);
+		clazz.interfaceSize = sizeof(SoftwareRendererInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
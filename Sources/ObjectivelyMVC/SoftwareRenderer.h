@@ -0,0 +1,154 @@
+/*
+ * ObjectivelyMVC: MVC framework for OpenGL and SDL2 in c.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+
+#pragma once
+
+#include <ObjectivelyMVC/Renderer.h>
+
+/**
+ * @file
+ * @brief A software Renderer, for headless rendering, testing and benchmarking.
+ */
+
+/**
+ * @brief The maximum width and height of SoftwareRenderer textures, the minimum guaranteed by
+ * OpenGL 4.1.
+ */
+#define SOFTWARE_RENDERER_MAX_TEXTURE_SIZE 16384
+
+typedef struct SoftwareRenderer SoftwareRenderer;
+typedef struct SoftwareRendererInterface SoftwareRendererInterface;
+
+/**
+ * @brief A texture of a SoftwareRenderer.
+ */
+typedef struct {
+
+	/**
+	 * @brief The dimensions, in pixels.
+	 */
+	int w, h;
+
+	/**
+	 * @brief The pixels, in RGBA byte order, or `NULL` if this texture has been deleted.
+	 */
+	Uint8 *pixels;
+
+	/**
+	 * @brief The next deleted texture, if this texture has been deleted.
+	 */
+	GLuint next;
+} SoftwareTexture;
+
+/**
+ * @brief A software Renderer, for headless rendering, testing and benchmarking.
+ * @details Primitives are batched exactly as they are by Renderer, and are rasterized into an
+ * `SDL_Surface` rather than submitted to OpenGL. No OpenGL context is required, so this Renderer
+ * may be used on machines without a GPU, and with the `dummy` SDL video driver.
+ * @details Textures are sampled with nearest filtering, and blended with
+ * `GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA`, as they are by Renderer. Output is deterministic across
+ * machines, but is not pixel-identical to that of an OpenGL implementation.
+ * @remarks Views must still be attached to an `SDL_Window`, whose size should match that of the
+ * surface. Layer-backed Views are drawn, but their layers are not cached.
+ * @extends Renderer
+ */
+struct SoftwareRenderer {
+
+	/**
+	 * @brief The superclass.
+	 */
+	Renderer renderer;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	SoftwareRendererInterface *interface;
+
+	/**
+	 * @brief The clipping frame, in surface coordinates.
+	 * @private
+	 */
+	SDL_Rect clip;
+
+	/**
+	 * @brief The most recently deleted texture, whose slot is reused by the next texture created.
+	 * @private
+	 */
+	GLuint freeTextures;
+
+	/**
+	 * @brief The surface, 32 bits per pixel in RGBA byte order, into which frames are rendered.
+	 * @remarks The surface retains the previous frame. Renderer::beginFrame clears only the damaged
+	 * region, so Renderer::partialRedraw is supported without a back buffer copy.
+	 */
+	SDL_Surface *surface;
+
+	/**
+	 * @brief The textures, indexed by texture name minus one.
+	 * @private
+	 */
+	SoftwareTexture *textures;
+
+	/**
+	 * @brief The count of `textures`.
+	 * @private
+	 */
+	size_t textureCount;
+
+	/**
+	 * @brief The capacity of `textures`.
+	 * @private
+	 */
+	size_t textureCapacity;
+};
+
+/**
+ * @brief The SoftwareRenderer interface.
+ */
+struct SoftwareRendererInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	RendererInterface rendererInterface;
+
+	/**
+	 * @fn SoftwareRenderer *SoftwareRenderer::initWithSize(SoftwareRenderer *self, const SDL_Size *size)
+	 * @brief Initializes this SoftwareRenderer with a surface of the given size.
+	 * @param self The SoftwareRenderer.
+	 * @param size The surface size, in pixels.
+	 * @return The initialized SoftwareRenderer, or `NULL` on error.
+	 * @memberof SoftwareRenderer
+	 */
+	SoftwareRenderer *(*initWithSize)(SoftwareRenderer *self, const SDL_Size *size);
+};
+
+/**
+ * @fn Class *SoftwareRenderer::_SoftwareRenderer(void)
+ * @brief The SoftwareRenderer archetype.
+ * @return The SoftwareRenderer Class.
+ * @memberof SoftwareRenderer
+ */
+OBJECTIVELYMVC_EXPORT Class *_SoftwareRenderer(void);
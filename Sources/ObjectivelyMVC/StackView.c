@@ -72,8 +72,17 @@ static void layoutSubviews(View *self) {
 
 	super(View, self, layoutSubviews);
 
-	Array *subviews = $(self, visibleSubviews);
-	if (subviews->count) {
+	const Array *subviews = (Array *) self->subviews;
+
+	size_t count = 0;
+	for (size_t i = 0; i < subviews->count; i++) {
+		const View *subview = $(subviews, objectAtIndex, i);
+		if ($(self, isVisibleSubview, subview)) {
+			count++;
+		}
+	}
+
+	if (count) {
 
 		StackView *this = (StackView *) self;
 
@@ -89,11 +98,15 @@ static void layoutSubviews(View *self) {
 				break;
 		}
 
-		availableSize -= this->spacing * (subviews->count - 1);
+		availableSize -= this->spacing * (count - 1);
 
 		for (size_t i = 0; i < subviews->count; i++) {
 
 			const View *subview = $(subviews, objectAtIndex, i);
+			if ($(self, isVisibleSubview, subview) == false) {
+				continue;
+			}
+
 			const SDL_Size size = $(subview, size);
 
 			switch (this->axis) {
@@ -113,6 +126,9 @@ static void layoutSubviews(View *self) {
 		for (size_t i = 0; i < subviews->count; i++) {
 
 			View *subview = $(subviews, objectAtIndex, i);
+			if ($(self, isVisibleSubview, subview) == false) {
+				continue;
+			}
 
 			switch (this->axis) {
 				case StackViewAxisVertical:
@@ -143,10 +159,10 @@ static void layoutSubviews(View *self) {
 				case StackViewDistributionFillEqually:
 					switch (this->axis) {
 						case StackViewAxisVertical:
-							subviewSize.h = availableSize / (float) subviews->count;
+							subviewSize.h = availableSize / (float) count;
 							break;
 						case StackViewAxisHorizontal:
-							subviewSize.w = availableSize / (float) subviews->count;
+							subviewSize.w = availableSize / (float) count;
 							break;
 					}
 					break;
@@ -166,8 +182,6 @@ static void layoutSubviews(View *self) {
 			pos += this->spacing;
 		}
 	}
-
-	release(subviews);
 }
 
 /**
@@ -190,10 +204,18 @@ static SDL_Size sizeThatFits(const View *self) {
 				break;
 		}
 
-		Array *subviews = $(self, visibleSubviews);
+		size_t count = 0;
+
+		const Array *subviews = (Array *) self->subviews;
 		for (size_t i = 0; i < subviews->count; i++) {
 
 			const View *subview = $(subviews, objectAtIndex, i);
+			if ($(self, isVisibleSubview, subview) == false) {
+				continue;
+			}
+
+			count++;
+
 			const SDL_Size subviewSize = $(subview, sizeThatContains);
 
 			switch (this->axis) {
@@ -206,18 +228,16 @@ static SDL_Size sizeThatFits(const View *self) {
 			}
 		}
 
-		if (subviews->count) {
+		if (count) {
 			switch (this->axis) {
 				case StackViewAxisVertical:
-					size.h += this->spacing * (subviews->count - 1);
+					size.h += this->spacing * (count - 1);
 					break;
 				case StackViewAxisHorizontal:
-					size.w += this->spacing * (subviews->count - 1);
+					size.w += this->spacing * (count - 1);
 					break;
 			}
 		}
-
-		release(subviews);
 	}
 
 	return size;
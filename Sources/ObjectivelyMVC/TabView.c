@@ -252,7 +252,7 @@ static void selectTab(TabView *self, TabViewItem *tab) {
 			}
 		}
 
-		self->stackView.view.needsLayout = true;
+		$((View *) self, setNeedsLayout);
 	}
 }
 
@@ -107,6 +107,8 @@ static void setState(TabViewItem *self, int state) {
 	} else {
 		self->label->view.backgroundColor = Colors.Clear;
 	}
+
+	$((View *) self->label, setNeedsDisplay);
 }
 
 #pragma mark - Class lifecycle
@@ -42,8 +42,11 @@ static void dealloc(Object *self) {
 	release(this->columns);
 	release(this->contentView);
 	release(this->headerView);
+	release(this->reusableCells);
+	release(this->reusableRows);
 	release(this->rows);
 	release(this->scrollView);
+	release(this->selectedRows);
 
 	super(Object, self, dealloc);
 }
@@ -85,7 +88,8 @@ static void awakeWithDictionary(View *self, const Dictionary *dictionary) {
 		MakeInlet("alternateBackgroundColor", InletTypeColor, &this->alternateBackgroundColor, NULL),
 		MakeInlet("cellSpacing", InletTypeInteger, &this->cellSpacing, NULL),
 		MakeInlet("rowHeight", InletTypeInteger, &this->rowHeight, NULL),
-		MakeInlet("usesAlternateBackgroundColor", InletTypeBool, &this->usesAlternateBackgroundColor, NULL)
+		MakeInlet("usesAlternateBackgroundColor", InletTypeBool, &this->usesAlternateBackgroundColor, NULL),
+		MakeInlet("virtualized", InletTypeBool, &this->virtualized, NULL)
 	);
 
 	$(self, bind, inlets, dictionary);
@@ -103,6 +107,161 @@ static View *init(View *self) {
 	return (View *) $((TableView *) self, initWithFrame, NULL, ControlStyleDefault);
 }
 
+/**
+ * @return The maximum length of each reuse queue: one screen of rows, plus overscan.
+ */
+static size_t reuseCapacity(const TableView *self) {
+
+	const SDL_Rect area = $(self, scrollableArea);
+
+	return area.h / self->rowHeight + 1 + 2 * TABLE_VIEW_VIRTUAL_OVERSCAN;
+}
+
+/**
+ * @brief Moves the cells of the given row to the reuse queue of their respective columns.
+ * @remarks Cells in excess of the reuse capacity are released.
+ */
+static void enqueueReusableCells(TableView *self, TableRowView *row) {
+
+	const size_t capacity = reuseCapacity(self);
+
+	const Array *cells = (Array *) row->cells;
+	const Array *columns = (Array *) self->columns;
+
+	for (size_t i = 0; i < cells->count && i < columns->count; i++) {
+
+		const TableColumn *column = $(columns, objectAtIndex, i);
+
+		MutableArray *reusableCells = $((Dictionary *) self->reusableCells, objectForKey, (ident) column);
+		if (reusableCells == NULL) {
+			reusableCells = $$(MutableArray, array);
+			$(self->reusableCells, setObjectForKey, reusableCells, (ident) column);
+			release(reusableCells);
+		}
+
+		if (((Array *) reusableCells)->count < capacity) {
+			TableCellView *cell = $(cells, objectAtIndex, i);
+			$(reusableCells, addObject, cell);
+		}
+	}
+
+	$(row, removeAllCells);
+}
+
+/**
+ * @brief Materializes the row at the given index, reusing a recycled row if one is available.
+ * @return The retained TableRowView.
+ */
+static TableRowView *rowForIndex(TableView *self, size_t index) {
+
+	TableRowView *row;
+
+	const Array *reusableRows = (Array *) self->reusableRows;
+	if (reusableRows->count) {
+		row = retain($(reusableRows, lastObject));
+		$(self->reusableRows, removeLastObject);
+	} else {
+		row = $(alloc(TableRowView), initWithTableView, self);
+		assert(row);
+	}
+
+	const Array *columns = (Array *) self->columns;
+	for (size_t i = 0; i < columns->count; i++) {
+		const TableColumn *column = $(columns, objectAtIndex, i);
+
+		TableCellView *cell = self->delegate.cellForColumnAndRow(self, column, index);
+		assert(cell);
+
+		$(row, addCell, cell);
+		release(cell);
+	}
+
+	return row;
+}
+
+/**
+ * @brief Materializes the rows intersecting the visible area of the ScrollView, recycling those
+ * which have scrolled out of view.
+ */
+static void layoutSubviews_virtualize(TableView *self) {
+
+	assert(self->rowHeight);
+
+	const SDL_Rect area = $(self, scrollableArea);
+	const int offset = -self->scrollView->contentOffset.y;
+
+	ssize_t first = offset / self->rowHeight - TABLE_VIEW_VIRTUAL_OVERSCAN;
+	ssize_t last = (offset + area.h) / self->rowHeight + 1 + TABLE_VIEW_VIRTUAL_OVERSCAN;
+
+	first = clamp(first, 0, (ssize_t) self->numberOfRows);
+	last = clamp(last, first, (ssize_t) self->numberOfRows);
+
+	const Array *rows = (Array *) self->rows;
+
+	if (first == (ssize_t) self->firstRow && last - first == (ssize_t) rows->count) {
+		return;
+	}
+
+	MutableArray *visibleRows = $$(MutableArray, arrayWithCapacity, last - first);
+
+	const size_t capacity = reuseCapacity(self);
+
+	for (size_t i = 0; i < rows->count; i++) {
+
+		TableRowView *row = $(rows, objectAtIndex, i);
+
+		const ssize_t index = (ssize_t) (self->firstRow + i);
+		if (index < first || index >= last) {
+			enqueueReusableCells(self, row);
+			$((View *) row, removeFromSuperview);
+
+			if (((Array *) self->reusableRows)->count < capacity) {
+				$(self->reusableRows, addObject, row);
+			}
+		}
+	}
+
+	View *contentView = (View *) self->contentView;
+	View *anchor = NULL;
+
+	for (ssize_t index = first; index < last; index++) {
+
+		TableRowView *row;
+		if (index >= (ssize_t) self->firstRow && index < (ssize_t) (self->firstRow + rows->count)) {
+			row = retain($(rows, objectAtIndex, index - self->firstRow));
+		} else {
+			row = rowForIndex(self, index);
+		}
+
+		View *view = (View *) row;
+		if (view->superview != contentView) {
+
+			View *head = $((Array *) contentView->subviews, firstObject);
+			if (anchor) {
+				$(contentView, addSubviewRelativeTo, view, anchor, ViewPositionAfter);
+			} else if (head) {
+				$(contentView, addSubviewRelativeTo, view, head, ViewPositionBefore);
+			} else {
+				$(contentView, addSubview, view);
+			}
+		}
+
+		$(visibleRows, addObject, row);
+		release(row);
+
+		anchor = view;
+	}
+
+	release(self->rows);
+	self->rows = visibleRows;
+
+	self->firstRow = first;
+
+	contentView->padding.top = first * self->rowHeight;
+	contentView->padding.bottom = (self->numberOfRows - last) * self->rowHeight;
+	$(contentView, setNeedsLayout);
+}
+
 /**
  * @see View::layoutSubviews(View *)
  */
@@ -113,7 +272,11 @@ static void layoutSubviews(View *self) {
 	View *scrollView = (View *) this->scrollView;
 
 	scrollView->frame = $(this, scrollableArea);
-	scrollView->needsLayout = true;
+	$(scrollView, setNeedsLayout);
+
+	if (this->virtualized) {
+		layoutSubviews_virtualize(this);
+	}
 
 	const Array *rows = (Array *) this->rows;
 	for (size_t i = 0; i < rows->count; i++) {
@@ -121,13 +284,16 @@ static void layoutSubviews(View *self) {
 		TableRowView *row = (TableRowView *) $(rows, objectAtIndex, i);
 		row->stackView.view.frame.h = this->rowHeight;
 
-		if (this->usesAlternateBackgroundColor && (i & 1)) {
+		const size_t index = this->firstRow + i;
+
+		if (this->usesAlternateBackgroundColor && (index & 1)) {
 			row->assignedBackgroundColor = this->alternateBackgroundColor;
 		} else {
 			row->assignedBackgroundColor = Colors.Clear;
 		}
 
-		row->stackView.view.backgroundColor = row->assignedBackgroundColor;
+		const _Bool isSelected = $((IndexSet *) this->selectedRows, containsIndex, index);
+		$(row, setSelected, isSelected);
 	}
 
 	super(View, self, layoutSubviews);
@@ -187,23 +353,22 @@ static _Bool captureEvent(Control *self, const SDL_Event *event) {
 
 				const ssize_t index = $(this, rowAtPoint, &point);
 
-				const Array *rows = (Array *) this->rows;
-				if (index > -1 && index < rows->count) {
+				if (index > -1 && index < this->numberOfRows) {
 
-					TableRowView *row = $(rows, objectAtIndex, index);
+					const _Bool isSelected = $((IndexSet *) this->selectedRows, containsIndex, index);
 
 					switch (this->control.selection) {
 						case ControlSelectionNone:
 							break;
 						case ControlSelectionSingle:
-							if (row->isSelected == false) {
+							if (isSelected == false) {
 								$(this, deselectAll);
 								$(this, selectRowAtIndex, index);
 							}
 							break;
 						case ControlSelectionMultiple:
 							if (SDL_GetModState() & (KMOD_CTRL | KMOD_GUI)) {
-								if (row->isSelected) {
+								if (isSelected) {
 									$(this, deselectRowAtIndex, index);
 								} else {
 									$(this, selectRowAtIndex, index);
@@ -233,6 +398,19 @@ static _Bool captureEvent(Control *self, const SDL_Event *event) {
 }
 
 
+#pragma mark - ScrollViewDelegate
+
+/**
+ * @see ScrollViewDelegate::didScroll(ScrollView *)
+ */
+static void didScroll(ScrollView *scrollView) {
+
+	TableView *this = (TableView *) scrollView->delegate.self;
+	if (this->virtualized) {
+		$((View *) this, setNeedsLayout);
+	}
+}
+
 #pragma mark - TableView
 
 /**
@@ -296,6 +474,26 @@ static TableColumn *columnWithIdentifier(const TableView *self, const char *iden
 	return NULL;
 }
 
+/**
+ * @fn TableCellView *TableView::dequeueReusableCell(TableView *self, const TableColumn *column)
+ * @memberof TableView
+ */
+static TableCellView *dequeueReusableCell(TableView *self, const TableColumn *column) {
+
+	assert(column);
+
+	MutableArray *reusableCells = $((Dictionary *) self->reusableCells, objectForKey, (ident) column);
+	if (reusableCells && reusableCells->array.count) {
+
+		TableCellView *cell = retain($((Array *) reusableCells, lastObject));
+		$(reusableCells, removeLastObject);
+
+		return cell;
+	}
+
+	return NULL;
+}
+
 /**
  * @brief ArrayEnumerator for all Row deselection.
  */
@@ -308,20 +506,39 @@ static void deselectAll_enumerate(const Array *array, ident obj, ident data) {
  * @memberof TableView
  */
 static void deselectAll(TableView *self) {
+
+	$(self->selectedRows, removeAllIndexes);
+
 	$((Array *) self->rows, enumerateObjects, deselectAll_enumerate, NULL);
 }
 
+/**
+ * @return The materialized row at the given index, or `NULL`.
+ */
+static TableRowView *materializedRowAtIndex(const TableView *self, size_t index) {
+
+	const Array *rows = (Array *) self->rows;
+	if (index >= self->firstRow && index < self->firstRow + rows->count) {
+		return $(rows, objectAtIndex, index - self->firstRow);
+	}
+
+	return NULL;
+}
+
 /**
  * @fn void TableView::deselectRowAtIndex(TableView *self, size_t index)
  * @memberof TableView
  */
 static void deselectRowAtIndex(TableView *self, size_t index) {
 
-	const Array *rows = (Array *) self->rows;
-	if (index < rows->count) {
+	if (index < self->numberOfRows) {
 
-		TableRowView *row = $(rows, objectAtIndex, index);
-		$(row, setSelected, false);
+		$(self->selectedRows, removeIndex, index);
+
+		TableRowView *row = materializedRowAtIndex(self, index);
+		if (row) {
+			$(row, setSelected, false);
+		}
 	}
 }
 
@@ -349,9 +566,18 @@ static TableView *initWithFrame(TableView *self, const SDL_Rect *frame, ControlS
 		self->columns = $$(MutableArray, array);
 		assert(self->columns);
 
+		self->reusableCells = $$(MutableDictionary, dictionary);
+		assert(self->reusableCells);
+
+		self->reusableRows = $$(MutableArray, array);
+		assert(self->reusableRows);
+
 		self->rows = $$(MutableArray, array);
 		assert(self->rows);
 
+		self->selectedRows = $(alloc(MutableIndexSet), init);
+		assert(self->selectedRows);
+
 		self->headerView = $(alloc(TableHeaderView), initWithTableView, self);
 		assert(self->headerView);
 
@@ -367,6 +593,9 @@ static TableView *initWithFrame(TableView *self, const SDL_Rect *frame, ControlS
 
 		self->scrollView->control.view.autoresizingMask |= ViewAutoresizingWidth;
 
+		self->scrollView->delegate.self = self;
+		self->scrollView->delegate.didScroll = didScroll;
+
 		$(self->scrollView, setContentView, (View *) self->contentView);
 
 		$((View *) self, addSubview, (View *) self->scrollView);
@@ -417,6 +646,16 @@ static void reloadData(TableView *self) {
 	$((Array *) self->rows, enumerateObjects, reloadData_removeRows, self->contentView);
 	$(self->rows, removeAllObjects);
 
+	$(self->reusableCells, removeAllObjects);
+	$(self->reusableRows, removeAllObjects);
+
+	$(self->selectedRows, removeAllIndexes);
+
+	self->firstRow = 0;
+
+	View *contentView = (View *) self->contentView;
+	contentView->padding.top = contentView->padding.bottom = 0;
+
 	TableRowView *headerView = (TableRowView *) self->headerView;
 	$(headerView, removeAllCells);
 
@@ -427,29 +666,21 @@ static void reloadData(TableView *self) {
 		$(headerView, addCell, (TableCellView *) column->headerCell);
 	}
 
-	const size_t numberOfRows = self->dataSource.numberOfRows(self);
-	for (size_t i = 0; i < numberOfRows; i++) {
+	self->numberOfRows = self->dataSource.numberOfRows(self);
 
-		TableRowView *row = $(alloc(TableRowView), initWithTableView, self);
-		assert(row);
+	if (self->virtualized == false) {
+		for (size_t i = 0; i < self->numberOfRows; i++) {
 
-		$(self->rows, addObject, row);
-		release(row);
-
-		for (size_t j = 0; j < columns->count; j++) {
-			const TableColumn *column = $(columns, objectAtIndex, j);
-
-			TableCellView *cell = self->delegate.cellForColumnAndRow(self, column, i);
-			assert(cell);
+			TableRowView *row = rowForIndex(self, i);
 
-			$(row, addCell, cell);
-			release(cell);
+			$(self->rows, addObject, row);
+			release(row);
 		}
-	}
 
-	$((Array *) self->rows, enumerateObjects, reloadData_addRows, self->contentView);
+		$((Array *) self->rows, enumerateObjects, reloadData_addRows, self->contentView);
+	}
 
-	self->control.view.needsLayout = true;
+	$((View *) self, setNeedsLayout);
 }
 
 /**
@@ -467,6 +698,8 @@ static void removeColumn(TableView *self, TableColumn *column) {
 
 	$(self->columns, removeObject, column);
 
+	$(self->reusableCells, removeObjectForKey, (ident) column);
+
 	$((TableRowView *) self->headerView, removeCell, (TableCellView *) column->headerCell);
 }
 
@@ -516,6 +749,9 @@ static void selectAll_enumerate(const Array *array, ident obj, ident data) {
  * @memberof TableView
  */
 static void selectAll(TableView *self) {
+
+	$(self->selectedRows, addIndexesInRange, (Range) { .location = 0, .length = self->numberOfRows });
+
 	$((Array *) self->rows, enumerateObjects, selectAll_enumerate, NULL);
 }
 
@@ -525,19 +761,9 @@ static void selectAll(TableView *self) {
  */
 static IndexSet *selectedRowIndexes(const TableView *self) {
 
-	size_t indexes[self->rows->array.count];
-	size_t count = 0;
+	const IndexSet *selectedRows = (IndexSet *) self->selectedRows;
 
-	const Array *rows = (Array *) self->rows;
-	for (size_t i = 0; i < rows->count; i++) {
-
-		const TableRowView *row = $(rows, objectAtIndex, i);
-		if (row->isSelected) {
-			indexes[count++] = i;
-		}
-	}
-
-	return $(alloc(IndexSet), initWithIndexes, indexes, count);
+	return $(alloc(IndexSet), initWithIndexes, selectedRows->indexes, selectedRows->count);
 }
 
 /**
@@ -546,11 +772,14 @@ static IndexSet *selectedRowIndexes(const TableView *self) {
  */
 static void selectRowAtIndex(TableView *self, size_t index) {
 
-	const Array *rows = (Array *) self->rows;
-	if (index < rows->count) {
+	if (index < self->numberOfRows) {
 
-		TableRowView *row = $(rows, objectAtIndex, index);
-		$(row, setSelected, true);
+		$(self->selectedRows, addIndex, index);
+
+		TableRowView *row = materializedRowAtIndex(self, index);
+		if (row) {
+			$(row, setSelected, true);
+		}
 	}
 }
 
@@ -616,6 +845,7 @@ static void initialize(Class *clazz) {
 	((TableViewInterface *) clazz->def->interface)->addColumn = addColumn;
 	((TableViewInterface *) clazz->def->interface)->columnAtPoint = columnAtPoint;
 	((TableViewInterface *) clazz->def->interface)->columnWithIdentifier = columnWithIdentifier;
+	((TableViewInterface *) clazz->def->interface)->dequeueReusableCell = dequeueReusableCell;
 	((TableViewInterface *) clazz->def->interface)->deselectAll = deselectAll;
 	((TableViewInterface *) clazz->def->interface)->deselectRowAtIndex = deselectRowAtIndex;
 	((TableViewInterface *) clazz->def->interface)->deselectRowsAtIndexes = deselectRowsAtIndexes;
@@ -23,8 +23,9 @@
 
 #pragma once
 
-#include <Objectively/IndexSet.h>
 #include <Objectively/MutableArray.h>
+#include <Objectively/MutableDictionary.h>
+#include <Objectively/MutableIndexSet.h>
 
 #include <ObjectivelyMVC/Control.h>
 #include <ObjectivelyMVC/ScrollView.h>
@@ -93,6 +94,8 @@ struct TableViewDelegate {
 	 * @param column The TableColumn.
 	 * @param row The row number.
 	 * @return The cell for the given column and row number.
+	 * @remarks Virtualized TableViews call this function as rows scroll into view. Implementations
+	 * should attempt to reuse a cell via TableView::dequeueReusableCell before allocating one.
 	 */
 	TableCellView *(*cellForColumnAndRow)(const TableView *tableView, const TableColumn *column, size_t row);
 
@@ -118,6 +121,11 @@ struct TableViewDelegate {
 #define DEFAULT_TABLE_VIEW_CELL_SPACING 2
 #define DEFAULT_TABLE_VIEW_ROW_HEIGHT 24
 
+/**
+ * @brief The number of rows materialized above and below the visible area of virtualized tables.
+ */
+#define TABLE_VIEW_VIRTUAL_OVERSCAN 4
+
 /**
  * @brief TableViews provide sortable, tabular presentations of data.
  * @extends Control
@@ -166,13 +174,41 @@ struct TableView {
 	 */
 	TableViewDelegate delegate;
 
+	/**
+	 * @brief The index of the first row in `rows`.
+	 * @remarks This is always `0` unless the TableView is `virtualized`.
+	 */
+	size_t firstRow;
+
 	/**
 	 * @brief The header.
 	 */
 	TableHeaderView *headerView;
 
 	/**
-	 * @brief The rows.
+	 * @brief The number of rows reported by the data source at the last call to
+	 * TableView::reloadData.
+	 */
+	size_t numberOfRows;
+
+	/**
+	 * @brief Cells of recycled rows, keyed by TableColumn.
+	 * @remarks Each queue holds at most one screen of cells; the rest are released.
+	 * @private
+	 */
+	MutableDictionary *reusableCells;
+
+	/**
+	 * @brief Recycled rows, awaiting reuse.
+	 * @remarks This queue holds at most one screen of rows; the rest are released.
+	 * @private
+	 */
+	MutableArray *reusableRows;
+
+	/**
+	 * @brief The materialized rows.
+	 * @remarks If the TableView is `virtualized`, this contains only the rows intersecting the
+	 * visible area of the ScrollView, beginning at `firstRow`.
 	 */
 	MutableArray *rows;
 
@@ -186,6 +222,12 @@ struct TableView {
 	 */
 	ScrollView *scrollView;
 
+	/**
+	 * @brief The indexes of the selected rows.
+	 * @private
+	 */
+	MutableIndexSet *selectedRows;
+
 	/**
 	 * @brief The column to sort by.
 	 */
@@ -195,6 +237,13 @@ struct TableView {
 	 * @brief Set to `true` to enable alternate row coloring.
 	 */
 	_Bool usesAlternateBackgroundColor;
+
+	/**
+	 * @brief Set to `true` to materialize only the rows intersecting the visible area of the
+	 * ScrollView, recycling them as the TableView is scrolled.
+	 * @remarks Virtualized tables require a fixed, non-zero `rowHeight`.
+	 */
+	_Bool virtualized;
 };
 
 /**
@@ -234,6 +283,17 @@ struct TableViewInterface {
 	 */
 	TableColumn *(*columnWithIdentifier)(const TableView *self, const char *identifier);
 
+	/**
+	 * @fn TableCellView *TableView::dequeueReusableCell(TableView *self, const TableColumn *column)
+	 * @brief Dequeues a cell previously displayed in the given column for reuse.
+	 * @param self The TableView.
+	 * @param column The column.
+	 * @return A retained TableCellView, or `NULL` if no cell is available for reuse.
+	 * @remarks Cells are enqueued for reuse as rows of virtualized tables scroll out of view.
+	 * @memberof TableView
+	 */
+	TableCellView *(*dequeueReusableCell)(TableView *self, const TableColumn *column);
+
 	/**
 	 * @fn void TableView::deselectAll(TableView *self)
 	 * @brief Deselects all rows in this TableView.
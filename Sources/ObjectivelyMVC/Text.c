@@ -41,10 +41,6 @@ static void dealloc(Object *self) {
 
 	free(this->text);
 
-	if (this->texture) {
-		glDeleteTextures(1, &this->texture);
-	}
-
 	super(Object, self, dealloc);
 }
 
@@ -87,19 +83,13 @@ static void render(View *self, Renderer *renderer) {
 
 	if (this->text) {
 
-		if (this->texture == 0) {
-			SDL_Surface *surface = $(this->font, renderCharacters, this->text, this->color);
-			assert(surface);
-
-			this->texture = $(renderer, createTexture, surface);
+		const SDL_Rect frame = $(self, renderFrame);
 
-			SDL_FreeSurface(surface);
-		}
+		$(renderer, setDrawColor, &this->color);
 
-		assert(this->texture);
+		$(this->font, drawCharacters, renderer, this->text, &MakePoint(frame.x, frame.y));
 
-		const SDL_Rect frame = $(self, renderFrame);
-		$(renderer, drawTexture, this->texture, &frame);
+		$(renderer, setDrawColor, &Colors.White);
 	}
 }
 
@@ -112,8 +102,6 @@ static void renderDeviceDidReset(View *self) {
 
 	Text *this = (Text *) self;
 
-	this->texture = 0;
-
 	$(this->font, renderDeviceDidReset);
 }
 
@@ -173,12 +161,8 @@ static void setFont(Text *self, Font *font) {
 		release(self->font);
 		self->font = retain(font);
 
-		if (self->texture) {
-			glDeleteTextures(1, &self->texture);
-			self->texture = 0;
-		}
-
 		$((View *) self, sizeToFit);
+		$((View *) self, setNeedsDisplay);
 	}
 }
 
@@ -196,12 +180,8 @@ static void setText(Text *self, const char *text) {
 		self->text = NULL;
 	}
 
-	if (self->texture) {
-		glDeleteTextures(1, &self->texture);
-		self->texture = 0;
-	}
-
 	$((View *) self, sizeToFit);
+	$((View *) self, setNeedsDisplay);
 }
 
 #pragma mark - Class lifecycle
@@ -36,6 +36,8 @@ typedef struct TextInterface TextInterface;
 
 /**
  * @brief Text rendered with TrueType fonts.
+ * @details Text is drawn as a run of glyphs from its Font's shared atlas, so changing the text or
+ * color of a Text does not allocate any textures.
  * @extends View
  */
 struct Text {
@@ -69,12 +71,6 @@ struct Text {
 	 * @see Text::setText(Text *, const char *)
 	 */
 	char *text;
-
-	/**
-	 * @brief The rendered texture.
-	 * @protected
-	 */
-	GLuint texture;
 };
 
 /**
@@ -0,0 +1,118 @@
+/*
+ * ObjectivelyMVC: MVC framework for OpenGL and SDL2 in c.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <ObjectivelyMVC/Trace.h>
+
+/**
+ * @brief A trace event.
+ */
+typedef struct {
+	const char *name;
+	char phase;
+	SDL_threadID thread;
+	Uint64 timestamp;
+} TraceEvent;
+
+/**
+ * @brief The trace event ring buffer, allocated when the first event is recorded.
+ */
+static TraceEvent *_events;
+
+/**
+ * @brief The count of events recorded.
+ */
+static SDL_atomic_t _count;
+
+/**
+ * @brief The performance counter value of the first event, from which timestamps are written.
+ */
+static Uint64 _epoch;
+
+void MVC_TraceEvent(const char *name, char phase) {
+
+	assert(name);
+
+	TraceEvent *events = SDL_AtomicGetPtr((void **) &_events);
+	if (events == NULL) {
+
+		events = calloc(MVC_TRACE_CAPACITY, sizeof(TraceEvent));
+		assert(events);
+
+		if (SDL_AtomicCASPtr((void **) &_events, NULL, events)) {
+			_epoch = SDL_GetPerformanceCounter();
+		} else {
+			free(events);
+			events = SDL_AtomicGetPtr((void **) &_events);
+		}
+	}
+
+	const unsigned int index = (unsigned int) SDL_AtomicAdd(&_count, 1) % MVC_TRACE_CAPACITY;
+
+	TraceEvent *event = &events[index];
+
+	event->name = name;
+	event->phase = phase;
+	event->thread = SDL_ThreadID();
+	event->timestamp = SDL_GetPerformanceCounter();
+}
+
+_Bool MVC_TraceWrite(const char *path) {
+
+	assert(path);
+
+	FILE *file = fopen(path, "w");
+	if (file == NULL) {
+		return false;
+	}
+
+	fprintf(file, "{\"traceEvents\":[");
+
+	const TraceEvent *events = SDL_AtomicGetPtr((void **) &_events);
+	if (events) {
+
+		const unsigned int count = (unsigned int) SDL_AtomicGet(&_count);
+		const unsigned int first = count > MVC_TRACE_CAPACITY ? count - MVC_TRACE_CAPACITY : 0;
+
+		const double frequency = SDL_GetPerformanceFrequency() / 1000000.0;
+
+		for (unsigned int i = first; i < count; i++) {
+			const TraceEvent *event = &events[i % MVC_TRACE_CAPACITY];
+
+			fprintf(file, "%s\n{\"name\":\"%s\",\"ph\":\"%c\",\"pid\":1,\"tid\":%lu,\"ts\":%.3f}",
+					i == first ? "" : ",",
+					event->name,
+					event->phase,
+					(unsigned long) event->thread,
+					(Sint64) (event->timestamp - _epoch) / frequency);
+		}
+	}
+
+	fprintf(file, "\n]}\n");
+
+	return fclose(file) == 0;
+}
@@ -0,0 +1,83 @@
+/*
+ * ObjectivelyMVC: MVC framework for OpenGL and SDL2 in c.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+
+#pragma once
+
+#include <SDL2/SDL_atomic.h>
+#include <SDL2/SDL_thread.h>
+#include <SDL2/SDL_timer.h>
+
+#include <ObjectivelyMVC/Types.h>
+
+/**
+ * @file
+ * @brief Trace events for profiling frame phases, exported in the Chrome trace event format.
+ * @details Trace events are recorded only when ObjectivelyMVC is configured with
+ * `--enable-trace`, which defines `MVC_TRACE`. Otherwise, MVC_TraceBegin and MVC_TraceEnd compile
+ * to nothing. Recorded events may be written with MVC_TraceWrite and opened in `chrome://tracing`
+ * or Perfetto.
+ */
+
+/**
+ * @brief The capacity of the trace event ring buffer, a power of two. The oldest events are
+ * overwritten.
+ */
+#define MVC_TRACE_CAPACITY 65536
+
+#if defined(MVC_TRACE)
+
+/**
+ * @brief Records the beginning of the named scope.
+ * @param name A string literal naming the scope.
+ */
+#define MVC_TraceBegin(name) MVC_TraceEvent(name, 'B')
+
+/**
+ * @brief Records the end of the named scope.
+ * @param name A string literal naming the scope.
+ */
+#define MVC_TraceEnd(name) MVC_TraceEvent(name, 'E')
+
+#else
+
+#define MVC_TraceBegin(name)
+#define MVC_TraceEnd(name)
+
+#endif
+
+/**
+ * @brief Records a trace event.
+ * @param name The event name, which must remain valid until the trace is written.
+ * @param phase The event phase, `'B'` or `'E'`.
+ * @remarks This function is lock-free and may be called from any thread. Use the MVC_TraceBegin
+ * and MVC_TraceEnd macros, rather than calling it directly.
+ */
+OBJECTIVELYMVC_EXPORT void MVC_TraceEvent(const char *name, char phase);
+
+/**
+ * @brief Writes the recorded trace events to the given file, in the Chrome trace event format.
+ * @param path The file path.
+ * @return True on success, false on error.
+ */
+OBJECTIVELYMVC_EXPORT _Bool MVC_TraceWrite(const char *path);
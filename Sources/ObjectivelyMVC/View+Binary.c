@@ -0,0 +1,583 @@
+/*
+ * ObjectivelyMVC: MVC framework for OpenGL and SDL2 in c.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+
+#include <assert.h>
+#include <string.h>
+
+#include <Objectively.h>
+
+#include <ObjectivelyMVC.h>
+
+#define _Class _View
+
+#pragma mark - Compilation
+
+/**
+ * @brief The state of a compilation.
+ */
+typedef struct {
+
+	/**
+	 * @brief The encoded root value.
+	 */
+	MutableData *values;
+
+	/**
+	 * @brief The interned Strings, in order of first use.
+	 */
+	MutableArray *strings;
+
+	/**
+	 * @brief The indexes of the interned Strings, keyed by String.
+	 */
+	MutableDictionary *indexes;
+
+	/**
+	 * @brief The interned Numbers, in order of first use.
+	 */
+	MutableArray *numbers;
+
+	/**
+	 * @brief The indexes of the interned Numbers, keyed by Number.
+	 */
+	MutableDictionary *numberIndexes;
+
+	/**
+	 * @brief True if an unsupported value was encountered.
+	 */
+	_Bool failed;
+} Compiler;
+
+/**
+ * @brief Appends `value` to `data` in little-endian byte order.
+ */
+static void writeUInt32(MutableData *data, uint32_t value) {
+
+	const uint8_t bytes[] = {
+		value & 0xff, (value >> 8) & 0xff, (value >> 16) & 0xff, (value >> 24) & 0xff
+	};
+
+	$(data, appendBytes, bytes, sizeof(bytes));
+}
+
+/**
+ * @brief Appends `value` to `data` in little-endian byte order.
+ */
+static void writeDouble(MutableData *data, double value) {
+
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+
+	writeUInt32(data, (uint32_t) bits);
+	writeUInt32(data, (uint32_t) (bits >> 32));
+}
+
+/**
+ * @brief Appends `tag` to `data`.
+ */
+static void writeTag(MutableData *data, ViewDescriptionTag tag) {
+
+	const uint8_t byte = tag;
+
+	$(data, appendBytes, &byte, 1);
+}
+
+/**
+ * @brief Appends the index of `obj` in `table`, interning it if necessary.
+ */
+static void writeIndex(Compiler *compiler, MutableArray *table, MutableDictionary *indexes, const ident obj) {
+
+	const Number *index = $((Dictionary *) indexes, objectForKey, obj);
+	if (index == NULL) {
+
+		Number *number = $$(Number, numberWithValue, ((Array *) table)->count);
+
+		$(indexes, setObjectForKey, number, obj);
+		$(table, addObject, obj);
+
+		release(number);
+
+		index = $((Dictionary *) indexes, objectForKey, obj);
+	}
+
+	writeUInt32(compiler->values, (uint32_t) index->value);
+}
+
+/**
+ * @brief Appends the index of `number`, interning it if necessary.
+ */
+static void writeNumber(Compiler *compiler, const Number *number) {
+	writeIndex(compiler, compiler->numbers, compiler->numberIndexes, (ident) number);
+}
+
+/**
+ * @brief Appends the index of `string`, interning it if necessary.
+ */
+static void writeString(Compiler *compiler, const String *string) {
+	writeIndex(compiler, compiler->strings, compiler->indexes, (ident) string);
+}
+
+static _Bool compileValue(Compiler *compiler, const ident obj);
+
+/**
+ * @brief DictionaryEnumerator for compiling Dictionary entries.
+ */
+static void compileValue_enumerate(const Dictionary *dictionary, ident obj, ident key, ident data) {
+
+	Compiler *compiler = data;
+
+	if (compiler->failed == false) {
+		if (instanceof(String, key)) {
+			writeString(compiler, key);
+			compiler->failed = compileValue(compiler, obj) == false;
+		} else {
+			compiler->failed = true;
+		}
+	}
+}
+
+/**
+ * @brief Appends the encoding of `obj`.
+ * @return True on success, false if `obj` is of an unsupported type.
+ */
+static _Bool compileValue(Compiler *compiler, const ident obj) {
+
+	MutableData *values = compiler->values;
+
+	if (instanceof(Null, obj)) {
+		writeTag(values, ViewDescriptionTagNull);
+	} else if (instanceof(Boole, obj)) {
+		writeTag(values, ((Boole *) obj)->value ? ViewDescriptionTagTrue : ViewDescriptionTagFalse);
+	} else if (instanceof(Number, obj)) {
+		writeTag(values, ViewDescriptionTagNumber);
+		writeNumber(compiler, obj);
+	} else if (instanceof(String, obj)) {
+		writeTag(values, ViewDescriptionTagString);
+		writeString(compiler, obj);
+	} else if (instanceof(Array, obj)) {
+
+		const Array *array = obj;
+
+		_Bool numbers = array->count > 0;
+		for (size_t i = 0; i < array->count && numbers; i++) {
+			const ident element = $(array, objectAtIndex, i);
+			numbers = instanceof(Number, element) && !instanceof(Boole, element);
+		}
+
+		writeTag(values, numbers ? ViewDescriptionTagNumberArray : ViewDescriptionTagArray);
+		writeUInt32(values, (uint32_t) array->count);
+
+		for (size_t i = 0; i < array->count; i++) {
+			const ident element = $(array, objectAtIndex, i);
+			if (numbers) {
+				writeNumber(compiler, element);
+			} else if (compileValue(compiler, element) == false) {
+				return false;
+			}
+		}
+	} else if (instanceof(Dictionary, obj)) {
+
+		const Dictionary *dictionary = obj;
+
+		writeTag(values, ViewDescriptionTagDictionary);
+		writeUInt32(values, (uint32_t) dictionary->count);
+
+		$(dictionary, enumerateObjectsAndKeys, compileValue_enumerate, compiler);
+
+		return compiler->failed == false;
+	} else {
+		MVC_LogError("Unsupported type: %s\n", classof(obj)->name);
+		return false;
+	}
+
+	return true;
+}
+
+Data *MVC_CompileViewDescription(const ident obj) {
+
+	assert(obj);
+
+	Compiler compiler = {
+		.values = $$(MutableData, data),
+		.strings = $$(MutableArray, array),
+		.indexes = $$(MutableDictionary, dictionary),
+		.numbers = $$(MutableArray, array),
+		.numberIndexes = $$(MutableDictionary, dictionary),
+	};
+
+	MutableData *data = NULL;
+
+	if (compileValue(&compiler, obj)) {
+
+		data = $$(MutableData, data);
+
+		$(data, appendBytes, (const uint8_t *) VIEW_DESCRIPTION_MAGIC, 4);
+		writeUInt32(data, VIEW_DESCRIPTION_VERSION);
+
+		const Array *strings = (Array *) compiler.strings;
+		writeUInt32(data, (uint32_t) strings->count);
+
+		for (size_t i = 0; i < strings->count; i++) {
+
+			const String *string = $(strings, objectAtIndex, i);
+
+			writeUInt32(data, (uint32_t) string->length);
+			$(data, appendBytes, (const uint8_t *) string->chars, string->length);
+		}
+
+		const Array *numbers = (Array *) compiler.numbers;
+		writeUInt32(data, (uint32_t) numbers->count);
+
+		for (size_t i = 0; i < numbers->count; i++) {
+
+			const Number *number = $(numbers, objectAtIndex, i);
+
+			writeDouble(data, number->value);
+		}
+
+		$(data, appendData, (Data *) compiler.values);
+	}
+
+	release(compiler.values);
+	release(compiler.strings);
+	release(compiler.indexes);
+	release(compiler.numbers);
+	release(compiler.numberIndexes);
+
+	return (Data *) data;
+}
+
+#pragma mark - Decoding
+
+/**
+ * @brief The state of a decoding.
+ */
+typedef struct {
+
+	/**
+	 * @brief The compiled View description.
+	 */
+	const uint8_t *bytes;
+
+	/**
+	 * @brief The length of `bytes`, and the offset of the next value.
+	 */
+	size_t length, offset;
+
+	/**
+	 * @brief The interned Strings, each of which is retained by every value that uses it.
+	 */
+	String **strings;
+
+	/**
+	 * @brief The count of `strings`.
+	 */
+	uint32_t stringCount;
+
+	/**
+	 * @brief The interned Numbers, each of which is retained by every value that uses it.
+	 */
+	Number **numbers;
+
+	/**
+	 * @brief The count of `numbers`.
+	 */
+	uint32_t numberCount;
+} Decoder;
+
+/**
+ * @brief Reads `value` in little-endian byte order.
+ * @return True on success, false if `bytes` is exhausted.
+ */
+static _Bool readUInt32(Decoder *decoder, uint32_t *value) {
+
+	if (decoder->length - decoder->offset < 4) {
+		return false;
+	}
+
+	const uint8_t *b = decoder->bytes + decoder->offset;
+	*value = b[0] | (b[1] << 8) | (b[2] << 16) | ((uint32_t) b[3] << 24);
+
+	decoder->offset += 4;
+	return true;
+}
+
+/**
+ * @brief Reads `value` in little-endian byte order.
+ * @return True on success, false if `bytes` is exhausted.
+ */
+static _Bool readDouble(Decoder *decoder, double *value) {
+
+	uint32_t lo, hi;
+	if (readUInt32(decoder, &lo) && readUInt32(decoder, &hi)) {
+
+		const uint64_t bits = ((uint64_t) hi << 32) | lo;
+		memcpy(value, &bits, sizeof(bits));
+
+		return true;
+	}
+
+	return false;
+}
+
+/**
+ * @brief Reads the index of an interned Number.
+ * @return The Number, or `NULL` if the index is invalid.
+ */
+static Number *readNumber(Decoder *decoder) {
+
+	uint32_t index;
+	if (readUInt32(decoder, &index) && index < decoder->numberCount) {
+		return decoder->numbers[index];
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Reads the index of an interned String.
+ * @return The String, or `NULL` if the index is invalid.
+ */
+static String *readString(Decoder *decoder) {
+
+	uint32_t index;
+	if (readUInt32(decoder, &index) && index < decoder->stringCount) {
+		return decoder->strings[index];
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Reads a count of elements, each of which occupies at least `size` bytes.
+ * @return True on success, false if the count exceeds the remaining bytes.
+ */
+static _Bool readCount(Decoder *decoder, size_t size, uint32_t *count) {
+	return readUInt32(decoder, count) && *count <= (decoder->length - decoder->offset) / size;
+}
+
+/**
+ * @brief Decodes a value.
+ * @return The decoded value, which the caller must release, or `NULL` if `bytes` is malformed.
+ */
+static ident decodeValue(Decoder *decoder, int depth) {
+
+	if (depth > VIEW_DESCRIPTION_MAX_DEPTH || decoder->offset == decoder->length) {
+		return NULL;
+	}
+
+	const ViewDescriptionTag tag = decoder->bytes[decoder->offset++];
+	uint32_t count;
+
+	switch (tag) {
+		case ViewDescriptionTagNull:
+			return retain($$(Null, null));
+
+		case ViewDescriptionTagFalse:
+			return retain($$(Boole, False));
+
+		case ViewDescriptionTagTrue:
+			return retain($$(Boole, True));
+
+		case ViewDescriptionTagNumber: {
+			Number *number = readNumber(decoder);
+			return number ? retain(number) : NULL;
+		}
+
+		case ViewDescriptionTagString: {
+			String *string = readString(decoder);
+			return string ? retain(string) : NULL;
+		}
+
+		case ViewDescriptionTagArray:
+		case ViewDescriptionTagNumberArray: {
+
+			const size_t size = tag == ViewDescriptionTagArray ? 1 : 4;
+			if (readCount(decoder, size, &count) == false) {
+				return NULL;
+			}
+
+			MutableArray *array = $(alloc(MutableArray), initWithCapacity, count);
+			for (uint32_t i = 0; i < count; i++) {
+
+				ident element = NULL;
+				if (tag == ViewDescriptionTagArray) {
+					element = decodeValue(decoder, depth + 1);
+				} else {
+					Number *number = readNumber(decoder);
+					if (number) {
+						element = retain(number);
+					}
+				}
+
+				if (element == NULL) {
+					release(array);
+					return NULL;
+				}
+
+				$(array, addObject, element);
+				release(element);
+			}
+
+			return array;
+		}
+
+		case ViewDescriptionTagDictionary: {
+
+			if (readCount(decoder, 5, &count) == false) {
+				return NULL;
+			}
+
+			MutableDictionary *dictionary = $(alloc(MutableDictionary), initWithCapacity, count);
+			for (uint32_t i = 0; i < count; i++) {
+
+				String *key = readString(decoder);
+				ident obj = key ? decodeValue(decoder, depth + 1) : NULL;
+
+				if (obj == NULL) {
+					release(dictionary);
+					return NULL;
+				}
+
+				$(dictionary, setObjectForKey, obj, key);
+				release(obj);
+			}
+
+			return dictionary;
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Reads the string table.
+ * @return True on success, false if `bytes` is malformed.
+ */
+static _Bool readStrings(Decoder *decoder) {
+
+	uint32_t count;
+	if (readCount(decoder, 4, &count) == false) {
+		return false;
+	}
+
+	decoder->strings = calloc(count ?: 1, sizeof(String *));
+	assert(decoder->strings);
+
+	for (uint32_t i = 0; i < count; i++) {
+
+		uint32_t len;
+		if (readUInt32(decoder, &len) == false || len > decoder->length - decoder->offset) {
+			return false;
+		}
+
+		char *chars = malloc(len + 1);
+		assert(chars);
+
+		memcpy(chars, decoder->bytes + decoder->offset, len);
+		chars[len] = '\0';
+
+		decoder->strings[decoder->stringCount++] = $$(String, stringWithMemory, chars, len);
+		decoder->offset += len;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Reads the number table.
+ * @return True on success, false if `bytes` is malformed.
+ */
+static _Bool readNumbers(Decoder *decoder) {
+
+	uint32_t count;
+	if (readCount(decoder, sizeof(double), &count) == false) {
+		return false;
+	}
+
+	decoder->numbers = calloc(count ?: 1, sizeof(Number *));
+	assert(decoder->numbers);
+
+	for (uint32_t i = 0; i < count; i++) {
+
+		double value;
+		readDouble(decoder, &value);
+
+		decoder->numbers[decoder->numberCount++] = $$(Number, numberWithValue, value);
+	}
+
+	return true;
+}
+
+ident MVC_DecodeViewDescription(const uint8_t *bytes, size_t length) {
+
+	if (MVC_IsCompiledViewDescription(bytes, length) == false) {
+		MVC_LogError("Not a compiled View description\n");
+		return NULL;
+	}
+
+	Decoder decoder = {
+		.bytes = bytes,
+		.length = length,
+		.offset = 4
+	};
+
+	uint32_t version;
+	if (readUInt32(&decoder, &version) == false || version != VIEW_DESCRIPTION_VERSION) {
+		MVC_LogError("Unsupported version\n");
+		return NULL;
+	}
+
+	ident obj = NULL;
+
+	if (readStrings(&decoder) && readNumbers(&decoder)) {
+		obj = decodeValue(&decoder, 0);
+		if (obj && decoder.offset != decoder.length) {
+			release(obj);
+			obj = NULL;
+		}
+	}
+
+	for (uint32_t i = 0; i < decoder.stringCount; i++) {
+		release(decoder.strings[i]);
+	}
+
+	free(decoder.strings);
+
+	for (uint32_t i = 0; i < decoder.numberCount; i++) {
+		release(decoder.numbers[i]);
+	}
+
+	free(decoder.numbers);
+
+	if (obj == NULL) {
+		MVC_LogError("Malformed compiled View description\n");
+	}
+
+	return obj;
+}
+
+_Bool MVC_IsCompiledViewDescription(const uint8_t *bytes, size_t length) {
+	return length >= 8 && memcmp(bytes, VIEW_DESCRIPTION_MAGIC, 4) == 0;
+}
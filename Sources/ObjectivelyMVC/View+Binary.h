@@ -0,0 +1,127 @@
+/*
+ * ObjectivelyMVC: MVC framework for OpenGL and SDL2 in c.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+
+#pragma once
+
+#include <Objectively/Data.h>
+
+#include <ObjectivelyMVC/Types.h>
+
+/**
+ * @file
+ * @brief Compiled (binary) View descriptions.
+ * @details A compiled View description is a compact encoding of the object graph of a JSON View
+ * description. Strings and numbers are interned, so that loading one requires no text parsing,
+ * and allocates each distinct String and Number only once. All values are little-endian.
+ *
+ * The layout is:
+ *  * `"MVCV"`, followed by the version (`uint32_t`)
+ *  * The count of interned strings (`uint32_t`), each stored as its length (`uint32_t`) followed
+ *    by its characters, without a terminator
+ *  * The count of interned numbers (`uint32_t`), each stored as a `double`
+ *  * The root value
+ *
+ * Each value begins with a ViewDescriptionTag byte, followed by its payload.
+ *
+ * `mvc-compile` compiles JSON View descriptions to this format offline. View::viewWithData and
+ * View::viewWithContentsOfFile accept either format.
+ */
+
+#define VIEW_DESCRIPTION_MAGIC "MVCV"
+#define VIEW_DESCRIPTION_VERSION 2
+
+/**
+ * @brief The maximum nesting depth of a compiled View description.
+ */
+#define VIEW_DESCRIPTION_MAX_DEPTH 256
+
+/**
+ * @brief The tags of values in a compiled View description.
+ */
+typedef enum {
+
+	/**
+	 * @brief `Null`, with no payload.
+	 */
+	ViewDescriptionTagNull,
+
+	/**
+	 * @brief `Boole` false, with no payload.
+	 */
+	ViewDescriptionTagFalse,
+
+	/**
+	 * @brief `Boole` true, with no payload.
+	 */
+	ViewDescriptionTagTrue,
+
+	/**
+	 * @brief A `Number`, followed by its index in the number table (`uint32_t`).
+	 */
+	ViewDescriptionTagNumber,
+
+	/**
+	 * @brief A `String`, followed by its index in the string table (`uint32_t`).
+	 */
+	ViewDescriptionTagString,
+
+	/**
+	 * @brief An `Array`, followed by its count (`uint32_t`) and its values.
+	 */
+	ViewDescriptionTagArray,
+
+	/**
+	 * @brief An `Array` of `Number`s, followed by its count (`uint32_t`) and the index of each
+	 * element in the number table (`uint32_t`).
+	 */
+	ViewDescriptionTagNumberArray,
+
+	/**
+	 * @brief A `Dictionary`, followed by its count (`uint32_t`) and its entries, each of which is
+	 * the index of its key in the string table (`uint32_t`), followed by its value.
+	 */
+	ViewDescriptionTagDictionary,
+} ViewDescriptionTag;
+
+/**
+ * @brief Compiles the given JSON View description.
+ * @param obj The View description, as returned by `JSONSerialization::objectFromData`.
+ * @return The compiled View description, or `NULL` if it contains unsupported types.
+ */
+OBJECTIVELYMVC_EXPORT Data *MVC_CompileViewDescription(const ident obj);
+
+/**
+ * @brief Decodes the given compiled View description.
+ * @param bytes The compiled View description.
+ * @param length The length of `bytes`.
+ * @return The decoded object graph, or `NULL` if `bytes` is malformed.
+ * @remarks The returned object graph references no memory in `bytes`, which may be released or
+ * unmapped immediately. Equal Strings and Numbers within it are shared.
+ */
+OBJECTIVELYMVC_EXPORT ident MVC_DecodeViewDescription(const uint8_t *bytes, size_t length);
+
+/**
+ * @return True if `bytes` begins with a compiled View description header, false otherwise.
+ */
+OBJECTIVELYMVC_EXPORT _Bool MVC_IsCompiledViewDescription(const uint8_t *bytes, size_t length);
@@ -16,13 +16,93 @@
  * 3. This notice may not be removed or altered from any source distribution.
  */
 
+#include <ObjectivelyMVC/Config.h>
+
 #include <assert.h>
+#include <stdlib.h>
 #include <string.h>
 
+#if HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
+
+#if HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+
+#if HAVE_SYS_STAT_H
+#include <sys/stat.h>
+#endif
+
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
 #include <Objectively.h>
 
 #include <ObjectivelyMVC.h>
 
+/**
+ * @brief The View descriptions cached for `"include"` directives.
+ */
+static struct {
+
+	/**
+	 * @brief The resolved paths, keyed by path as specified by the directive.
+	 */
+	MutableDictionary *paths;
+
+	/**
+	 * @brief The View descriptions, keyed by resolved path.
+	 */
+	MutableDictionary *descriptions;
+
+	/**
+	 * @brief The modification times of the View descriptions when they were read, keyed by
+	 * resolved path.
+	 */
+	MutableDictionary *modificationTimes;
+
+	/**
+	 * @brief True if modification times are validated on each include.
+	 */
+	_Bool validate;
+} _includes;
+
+/**
+ * @return The modification time of the file at `path`, or 0.
+ */
+static time_t modificationTime(const char *path) {
+
+#if HAVE_SYS_STAT_H
+	struct stat st;
+	if (stat(path, &st) == 0) {
+		return st.st_mtime;
+	}
+#endif
+
+	return 0;
+}
+
+/**
+ * @return The canonical form of `path`, which the caller must free.
+ */
+static char *resolvePath(const char *path) {
+
+	char *resolved = NULL;
+
+#if HAVE_REALPATH
+	resolved = realpath(path, NULL);
+#endif
+
+	if (resolved == NULL) {
+		resolved = strdup(path);
+		assert(resolved);
+	}
+
+	return resolved;
+}
+
 /**
  * @brief InletBinding for InletTypeBool.
  */
@@ -121,14 +201,14 @@ static void bindFloat(const Inlet *inlet, ident obj) {
  * @brief InletBinding for InletTypeFont.
  */
 static void bindFont(const Inlet *inlet, ident obj) {
-	*((Font **) inlet->dest) = $(alloc(Font), initWithName, cast(String, obj)->chars);
+	*((Font **) inlet->dest) = $$(Font, fontWithName, cast(String, obj)->chars);
 }
 
 /**
  * @brief InletBinding for InletTypeImage.
  */
 static void bindImage(const Inlet *inlet, ident obj) {
-	*((Image **) inlet->dest) = $(alloc(Image), initWithName, cast(String, obj)->chars);
+	*((Image **) inlet->dest) = $$(Image, imageWithName, cast(String, obj)->chars);
 }
 
 /**
@@ -201,7 +281,10 @@ static void bindView(const Inlet *inlet, ident obj) {
 				$(view, awakeWithDictionary, dictionary);
 			}
 		} else if (includePath) {
-			view = $$(View, viewWithContentsOfFile, includePath->chars, NULL);
+			const Dictionary *description = MVC_IncludeViewDescription(includePath->chars);
+			if (description) {
+				view = $$(View, viewWithDictionary, description, NULL);
+			}
 		}
 
 		assert(view);
@@ -284,3 +367,126 @@ void bindInlets(const Inlet *inlets, const Dictionary *dictionary) {
 		}
 	}
 }
+
+void MVC_ClearIncludeCache(void) {
+
+	if (_includes.paths) {
+
+		release(_includes.paths);
+		release(_includes.descriptions);
+		release(_includes.modificationTimes);
+
+		_includes.paths = NULL;
+		_includes.descriptions = NULL;
+		_includes.modificationTimes = NULL;
+	}
+}
+
+ident MVC_IncludeViewDescription(const char *path) {
+
+	assert(path);
+
+	if (_includes.paths == NULL) {
+		_includes.paths = $$(MutableDictionary, dictionary);
+		_includes.descriptions = $$(MutableDictionary, dictionary);
+		_includes.modificationTimes = $$(MutableDictionary, dictionary);
+	}
+
+	String *key = $$(String, stringWithCharacters, path);
+
+	String *resolvedPath = $((Dictionary *) _includes.paths, objectForKey, key);
+	if (resolvedPath == NULL) {
+
+		char *resolved = resolvePath(path);
+
+		resolvedPath = $$(String, stringWithMemory, resolved, strlen(resolved));
+		$(_includes.paths, setObjectForKey, resolvedPath, key);
+		release(resolvedPath);
+	}
+
+	release(key);
+
+	ident description = $((Dictionary *) _includes.descriptions, objectForKey, resolvedPath);
+	if (description && _includes.validate) {
+
+		const Number *time = $((Dictionary *) _includes.modificationTimes, objectForKey, resolvedPath);
+		if (modificationTime(resolvedPath->chars) != (time_t) time->value) {
+			description = NULL;
+		}
+	}
+
+	if (description == NULL) {
+
+		Number *time = $$(Number, numberWithValue, modificationTime(resolvedPath->chars));
+
+		description = MVC_ReadViewDescription(resolvedPath->chars);
+		if (description) {
+			$(_includes.descriptions, setObjectForKey, description, resolvedPath);
+			$(_includes.modificationTimes, setObjectForKey, time, resolvedPath);
+			release(description);
+		} else {
+			$(_includes.descriptions, removeObjectForKey, resolvedPath);
+			$(_includes.modificationTimes, removeObjectForKey, resolvedPath);
+		}
+
+		release(time);
+	}
+
+	return description;
+}
+
+ident MVC_ReadViewDescription(const char *path) {
+
+	assert(path);
+
+#if HAVE_FCNTL_H && HAVE_SYS_MMAN_H && HAVE_SYS_STAT_H && HAVE_UNISTD_H
+	const int fd = open(path, O_RDONLY);
+	if (fd == -1) {
+		return NULL;
+	}
+
+	uint8_t header[8];
+	const _Bool compiled = read(fd, header, sizeof(header)) == sizeof(header)
+		&& MVC_IsCompiledViewDescription(header, sizeof(header));
+
+	if (compiled) {
+
+		ident obj = NULL;
+
+		struct stat st;
+		if (fstat(fd, &st) == 0) {
+
+			void *bytes = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (bytes != MAP_FAILED) {
+				obj = MVC_DecodeViewDescription(bytes, st.st_size);
+				munmap(bytes, st.st_size);
+			}
+		}
+
+		close(fd);
+		return obj;
+	}
+
+	close(fd);
+#endif
+
+	Data *data = $$(Data, dataWithContentsOfFile, path);
+	if (data == NULL) {
+		return NULL;
+	}
+
+	ident obj;
+	if (MVC_IsCompiledViewDescription(data->bytes, data->length)) {
+		obj = MVC_DecodeViewDescription(data->bytes, data->length);
+	} else {
+		obj = $$(JSONSerialization, objectFromData, data, 0);
+	}
+
+	release(data);
+
+	return obj;
+}
+
+void MVC_SetIncludeCacheValidation(_Bool validate) {
+	_includes.validate = validate;
+}
@@ -121,7 +121,9 @@ typedef enum {
 	 *      substitute a specialized or custom View implementation.
 	 *  * `"include"` - If the inbound View definition specifies an `"include"` directive, the
 	 *      specified JSON file will be recursively processed. The existing View is replaced with 
-	 *      the resulting View, and subsequently released.
+	 *      the resulting View, and subsequently released. The file is parsed once, and cached
+	 *      for subsequent includes.
+	 * @see MVC_SetIncludeCacheValidation(_Bool)
 	 * @see _initialize(Clazz *)
 	 * @see View::awakeWithDictionary(View *, const Dictionary *)
 	 * @see View::viewWithContentsOfFile(const char *path)
@@ -236,3 +238,36 @@ struct Outlet {
  * @brief Binds each Inlet specified in `inlets` to the data provided in `dictionary`.
  */
 OBJECTIVELYMVC_EXPORT void bindInlets(const Inlet *inlets, const Dictionary *dictionary);
+
+/**
+ * @brief Releases all View descriptions cached for `"include"` directives.
+ * @see InletTypeView
+ */
+OBJECTIVELYMVC_EXPORT void MVC_ClearIncludeCache(void);
+
+/**
+ * @brief Resolves the View description for an `"include"` directive, reading it as needed.
+ * @param path The path, as specified by the directive.
+ * @return The cached View description, or `NULL` on error.
+ * @remarks Descriptions are shared by all paths that resolve to the same file. The returned
+ * description is owned by the cache, and is valid until it is re-read or the cache is cleared.
+ * @see InletTypeView
+ * @see MVC_SetIncludeCacheValidation(_Bool)
+ */
+OBJECTIVELYMVC_EXPORT ident MVC_IncludeViewDescription(const char *path);
+
+/**
+ * @brief Reads the View description at `path`, which may be JSON or compiled.
+ * @param path The path.
+ * @return The View description, which the caller must release, or `NULL` on error.
+ * @remarks Compiled View descriptions are memory-mapped where supported.
+ */
+OBJECTIVELYMVC_EXPORT ident MVC_ReadViewDescription(const char *path);
+
+/**
+ * @brief Enables or disables validation of cached `"include"` directives.
+ * @param validate If true, each include checks the modification time of its file, and re-reads
+ * it if it has changed. This is useful during development, and is disabled by default.
+ * @see InletTypeView
+ */
+OBJECTIVELYMVC_EXPORT void MVC_SetIncludeCacheValidation(_Bool validate);
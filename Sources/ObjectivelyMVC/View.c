@@ -21,6 +21,8 @@
  * 3. This notice may not be removed or altered from any source distribution.
  */
 
+#include <ObjectivelyMVC/Config.h>
+
 #include <assert.h>
 #include <string.h>
 
@@ -30,6 +32,8 @@
 
 #define MVC_FIRST_RESPONDER "firstResponder"
 
+#define MAX_CONSTRAINT_PASSES 4
+
 const EnumName ViewAlignmentNames[] = MakeEnumNames(
 	MakeEnumName(ViewAlignmentNone),
 	MakeEnumName(ViewAlignmentTopLeft),
@@ -54,8 +58,478 @@ const EnumName ViewAutoresizingNames[] = MakeEnumNames(
 
 static __thread Outlet *_outlets;
 
+static unsigned int _renderGeneration = 1;
+
+static unsigned int _measureGeneration = 1;
+
+static unsigned int _hierarchyGeneration = 1;
+
 #define _Class _View
 
+/**
+ * @brief Marks each ancestor of the given View via `descendantsNeedLayout`.
+ * @remarks Propagation stops at the first ancestor already marked, as its ancestors are too.
+ */
+static void setAncestorsNeedLayout(View *self) {
+
+	for (View *view = self->superview; view && view->descendantsNeedLayout == false; view = view->superview) {
+		view->descendantsNeedLayout = true;
+	}
+}
+
+/**
+ * @brief Invalidates the cached measurement of the given View and each of its ancestors.
+ */
+static void invalidateMeasurements(View *self) {
+
+	for (View *view = self; view; view = view->superview) {
+		view->measureGeneration = 0;
+	}
+}
+
+/**
+ * @return The root View of the given View's hierarchy.
+ */
+static View *rootView(View *view) {
+
+	while (view->superview) {
+		view = view->superview;
+	}
+
+	return view;
+}
+
+/**
+ * @return The value of the given component of the View's frame.
+ */
+static int frameComponent(const View *view, ViewFrameComponent component) {
+
+	switch (component) {
+		case ViewFrameX:
+			return view->frame.x;
+		case ViewFrameY:
+			return view->frame.y;
+		case ViewFrameWidth:
+			return view->frame.w;
+		case ViewFrameHeight:
+			return view->frame.h;
+		default:
+			return 0;
+	}
+}
+
+/**
+ * @return The strength with which the ConstraintSolver holds the given variable at its current value.
+ * @remarks Components targeted by Constraints yield to them, preferring to adjust those which are
+ * not also read by other Constraints. Components that are only read are held firmly, so that
+ * Constraints never propagate backwards to their sources.
+ */
+static double frameVariableStrength(const ViewFrameVariable *variable) {
+
+	if (variable->targets == 0) {
+		return SOLVER_STRENGTH_STRONG;
+	}
+
+	return variable->sources ? SOLVER_STRENGTH_WEAK * 2.0 : SOLVER_STRENGTH_WEAK;
+}
+
+/**
+ * @brief Adjusts the reference counts of a component of the View's frame, binding it to the
+ * ConstraintSolver of the hierarchy rooted at `root` on first reference.
+ * @return The variable.
+ */
+static SolverVariable referenceFrameVariable(View *root, View *view, ViewFrameComponent component, int sources, int targets) {
+
+	ConstraintSolver *solver = root->constraintSolver;
+	ViewFrameVariable *variable = &view->frameVariables[component];
+
+	if (variable->variable == 0) {
+
+		_Bool bound = false;
+		for (int i = 0; i < ViewFrameComponents; i++) {
+			bound = bound || view->frameVariables[i].variable;
+		}
+
+		if (bound == false) {
+			view->nextConstrainedView = root->constrainedViews;
+			root->constrainedViews = view;
+		}
+
+		variable->variable = $(solver, createVariable);
+	}
+
+	const _Bool referenced = variable->sources || variable->targets;
+	const double strength = frameVariableStrength(variable);
+
+	variable->sources += sources;
+	variable->targets += targets;
+
+	if (variable->sources || variable->targets) {
+		if (referenced == false || strength != frameVariableStrength(variable)) {
+			$(solver, removeEditVariable, variable->variable);
+			$(solver, addEditVariable, variable->variable, frameVariableStrength(variable));
+			$(solver, suggestValue, variable->variable, frameComponent(view, component));
+		}
+	} else {
+		$(solver, removeEditVariable, variable->variable);
+	}
+
+	return variable->variable;
+}
+
+/**
+ * @brief Adjusts the reference counts of the frame components that make up `attribute`.
+ * @param terms Receives the terms of `attribute`, multiplied by `coefficient`.
+ * @return The count of terms.
+ */
+static size_t referenceConstraintAttribute(View *root, View *view, ConstraintAttribute attribute, double coefficient, _Bool target, int delta, SolverTerm *terms) {
+
+	ViewFrameComponent primary, secondary = ViewFrameComponents;
+	double scale = 0.0;
+
+	switch (attribute) {
+		case ConstraintAttributeNone:
+			return 0;
+
+		case ConstraintAttributeWidth:
+			primary = ViewFrameWidth;
+			break;
+		case ConstraintAttributeHeight:
+			primary = ViewFrameHeight;
+			break;
+
+		case ConstraintAttributeTop:
+			primary = ViewFrameY;
+			break;
+		case ConstraintAttributeMiddle:
+			primary = ViewFrameY;
+			secondary = ViewFrameHeight;
+			scale = 0.5;
+			break;
+		case ConstraintAttributeBottom:
+			primary = ViewFrameY;
+			secondary = ViewFrameHeight;
+			scale = 1.0;
+			break;
+
+		case ConstraintAttributeLeft:
+			primary = ViewFrameX;
+			break;
+		case ConstraintAttributeCenter:
+			primary = ViewFrameX;
+			secondary = ViewFrameWidth;
+			scale = 0.5;
+			break;
+		case ConstraintAttributeRight:
+			primary = ViewFrameX;
+			secondary = ViewFrameWidth;
+			scale = 1.0;
+			break;
+	}
+
+	size_t count = 0;
+
+	terms[count++] = (SolverTerm) {
+		.variable = referenceFrameVariable(root, view, primary, target ? 0 : delta, target ? delta : 0),
+		.coefficient = coefficient
+	};
+
+	if (secondary != ViewFrameComponents) {
+		terms[count++] = (SolverTerm) {
+			.variable = referenceFrameVariable(root, view, secondary, delta, 0),
+			.coefficient = coefficient * scale
+		};
+	}
+
+	return count;
+}
+
+/**
+ * @brief Adds the Constraint held by the View to the ConstraintSolver of the hierarchy rooted at `root`.
+ * @details The Constraint `target <relation> source * multiplier + constant` is added as
+ * `target - source * multiplier - constant <relation> 0`, with a strength derived from its priority.
+ * Its source View is resolved here, once, and held until the hierarchy changes.
+ */
+static void bindConstraint(View *root, View *view, Constraint *constraint) {
+
+	if (constraint->unresolvedGeneration == _hierarchyGeneration) {
+		return;
+	}
+
+	View *source = $(constraint, sourceForView, view);
+	if (source == NULL) {
+		MVC_LogWarn("%s: Failed to resolve %s\n", constraint->descriptor, constraint->identifier);
+		constraint->unresolvedGeneration = _hierarchyGeneration;
+		return;
+	}
+
+	constraint->unresolvedGeneration = 0;
+
+	SolverTerm terms[4];
+	size_t count = 0;
+
+	count += referenceConstraintAttribute(root, view, constraint->target, 1.0, true, 1, terms + count);
+	count += referenceConstraintAttribute(root, source, constraint->source, -constraint->multiplier, false, 1, terms + count);
+
+	const double strength = clamp(SOLVER_STRENGTH_MEDIUM * constraint->priority / DEFAULT_CONSTRAINT_PRIORITY,
+								  SOLVER_STRENGTH_WEAK * 10.0,
+								  SOLVER_STRENGTH_STRONG * 0.1);
+
+	constraint->solverConstraint = $(root->constraintSolver, addConstraint, terms, count, -constraint->constant, constraint->relation, strength);
+	constraint->sourceView = source;
+}
+
+/**
+ * @brief Removes the Constraint held by the View from the ConstraintSolver of the hierarchy rooted at `root`.
+ */
+static void unbindConstraint(View *root, View *view, Constraint *constraint) {
+
+	$(root->constraintSolver, removeConstraint, constraint->solverConstraint);
+
+	SolverTerm terms[4];
+
+	referenceConstraintAttribute(root, view, constraint->target, 1.0, true, -1, terms);
+	referenceConstraintAttribute(root, constraint->sourceView, constraint->source, 1.0, false, -1, terms + 2);
+
+	constraint->solverConstraint = 0;
+	constraint->sourceView = NULL;
+}
+
+/**
+ * @return True if the given View or any of its descendants is bound to a ConstraintSolver.
+ */
+static _Bool isConstrained(const View *view) {
+
+	for (int i = 0; i < ViewFrameComponents; i++) {
+		if (view->frameVariables[i].variable) {
+			return true;
+		}
+	}
+
+	const Array *subviews = (Array *) view->subviews;
+	for (size_t i = 0; i < subviews->count; i++) {
+		if (isConstrained($(subviews, objectAtIndex, i))) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @brief Unbinds the given View and its descendants, so that their Constraints are added to the
+ * ConstraintSolver of their hierarchy on the next layout pass.
+ */
+static void unbindConstraints(View *view) {
+
+	memset(view->frameVariables, 0, sizeof(view->frameVariables));
+	view->nextConstrainedView = NULL;
+
+	const Array *constraints = (Array *) view->constraints;
+	for (size_t i = 0; i < constraints->count; i++) {
+
+		Constraint *constraint = $(constraints, objectAtIndex, i);
+
+		constraint->solverConstraint = 0;
+		constraint->sourceView = NULL;
+	}
+
+	if (constraints->count) {
+		view->needsApplyConstraints = true;
+		setAncestorsNeedLayout(view);
+	}
+
+	const Array *subviews = (Array *) view->subviews;
+	for (size_t i = 0; i < subviews->count; i++) {
+		unbindConstraints($(subviews, objectAtIndex, i));
+	}
+}
+
+/**
+ * @brief Flags the given View to apply its Constraints if any of them failed to resolve.
+ */
+static void setUnresolvedConstraintsNeedApply(View *view) {
+
+	const Array *constraints = (Array *) view->constraints;
+	for (size_t i = 0; i < constraints->count; i++) {
+
+		const Constraint *constraint = $(constraints, objectAtIndex, i);
+		if (constraint->unresolvedGeneration) {
+			view->needsApplyConstraints = true;
+			setAncestorsNeedLayout(view);
+			break;
+		}
+	}
+}
+
+/**
+ * @brief Advances the hierarchy generation after `subview` is added to its superview, so that
+ * Constraints which failed to resolve are retried where it may now resolve them.
+ * @remarks Only Views within the subview, and its siblings, may resolve Views by way of it.
+ */
+static void hierarchyDidAddSubview(View *subview, _Bool recurse) {
+
+	if (recurse == false) {
+		_hierarchyGeneration++;
+
+		if (subview->identifier) {
+
+			const Array *siblings = (Array *) subview->superview->subviews;
+			for (size_t i = 0; i < siblings->count; i++) {
+				setUnresolvedConstraintsNeedApply($(siblings, objectAtIndex, i));
+			}
+		}
+	}
+
+	setUnresolvedConstraintsNeedApply(subview);
+
+	const Array *subviews = (Array *) subview->subviews;
+	for (size_t i = 0; i < subviews->count; i++) {
+		hierarchyDidAddSubview($(subviews, objectAtIndex, i), true);
+	}
+}
+
+/**
+ * @brief Unbinds `subview` and its descendants from the ConstraintSolver of the hierarchy rooted
+ * at `root`, along with any Constraints elsewhere in the hierarchy that resolved to them.
+ * @remarks This is called as a bound View leaves the hierarchy. The remainder of the hierarchy
+ * stays bound, and only the Constraints that referenced the departing Views are applied again.
+ */
+static void unbindSubview(View *root, View *subview) {
+
+	for (View *view = root->constrainedViews; view; view = view->nextConstrainedView) {
+
+		const _Bool departing = $(view, isDescendantOfView, subview);
+
+		const Array *constraints = (Array *) view->constraints;
+		for (size_t i = 0; i < constraints->count; i++) {
+
+			Constraint *constraint = $(constraints, objectAtIndex, i);
+			if (constraint->solverConstraint == 0) {
+				continue;
+			}
+
+			if (departing || $(constraint->sourceView, isDescendantOfView, subview)) {
+				unbindConstraint(root, view, constraint);
+
+				view->needsApplyConstraints = true;
+				setAncestorsNeedLayout(view);
+			}
+		}
+	}
+
+	View **next = &root->constrainedViews;
+	while (*next) {
+
+		View *view = *next;
+		if ($(view, isDescendantOfView, subview)) {
+
+			for (int i = 0; i < ViewFrameComponents; i++) {
+				if (view->frameVariables[i].variable) {
+					$(root->constraintSolver, removeVariable, view->frameVariables[i].variable);
+				}
+			}
+
+			memset(view->frameVariables, 0, sizeof(view->frameVariables));
+
+			*next = view->nextConstrainedView;
+			view->nextConstrainedView = NULL;
+		} else {
+			next = &view->nextConstrainedView;
+		}
+	}
+}
+
+/**
+ * @brief Releases the ConstraintSolver of the hierarchy rooted at `root`, unbinding its Views.
+ * @remarks This is called when `root` is deallocated, or joins another hierarchy, in which case
+ * each of its Constraints is added to the ConstraintSolver of that hierarchy instead.
+ */
+static void resetConstraintSolver(View *root) {
+
+	release(root->constraintSolver);
+
+	root->constraintSolver = NULL;
+	root->constrainedViews = NULL;
+
+	unbindConstraints(root);
+}
+
+/**
+ * @brief Solves the Constraints of the hierarchy rooted at `root`, and applies the solution.
+ * @details Each bound frame component is suggested at its current value, so that only the rows
+ * affected by frames that have changed since the last pass are re-solved.
+ * @return True if any frame was changed, false otherwise.
+ */
+static _Bool solveConstraints(View *root) {
+
+	MVC_TraceBegin("solveConstraints");
+
+	ConstraintSolver *solver = root->constraintSolver;
+
+	for (View *view = root->constrainedViews; view; view = view->nextConstrainedView) {
+		for (int i = 0; i < ViewFrameComponents; i++) {
+
+			const ViewFrameVariable *variable = &view->frameVariables[i];
+			if (variable->sources || variable->targets) {
+				$(solver, suggestValue, variable->variable, frameComponent(view, i));
+			}
+		}
+	}
+
+	_Bool changed = false;
+
+	for (View *view = root->constrainedViews; view; view = view->nextConstrainedView) {
+
+		int values[ViewFrameComponents];
+		_Bool moved = false, resized = false;
+
+		for (int i = 0; i < ViewFrameComponents; i++) {
+
+			values[i] = frameComponent(view, i);
+
+			const ViewFrameVariable *variable = &view->frameVariables[i];
+			if (variable->targets) {
+
+				const int value = (int) lround($(solver, valueOfVariable, variable->variable));
+				if (value != values[i]) {
+					values[i] = value;
+
+					if (i == ViewFrameX || i == ViewFrameY) {
+						moved = true;
+					} else {
+						resized = true;
+					}
+				}
+			}
+		}
+
+		if (moved) {
+			$(view, setNeedsDisplay);
+
+			view->frame.x = values[ViewFrameX];
+			view->frame.y = values[ViewFrameY];
+
+			invalidateMeasurements(view);
+			$(view, setNeedsDisplay);
+		}
+
+		if (resized) {
+			$(view, resize, &MakeSize(values[ViewFrameWidth], values[ViewFrameHeight]));
+		}
+
+		changed = changed || moved || resized;
+	}
+
+	if (changed) {
+		MVC_InvalidateRenderFrames();
+	}
+
+	MVC_TraceEnd("solveConstraints");
+
+	return changed;
+}
+
 #pragma mark - ObjectInterface
 
 /**
@@ -65,14 +539,32 @@ static void dealloc(Object *self) {
 
 	View *this = (View *) self;
 
-	release(this->constraints);
+	$(this, removeFromSuperview);
 
-	free(this->identifier);
+	if (this->constraintSolver) {
+		resetConstraintSolver(this);
+	}
 
-	$(this, removeFromSuperview);
+	const Array *subviews = (Array *) this->subviews;
+	for (size_t i = 0; i < subviews->count; i++) {
+
+		View *subview = $(subviews, objectAtIndex, i);
+
+		subview->superview = NULL;
+		$(subview, setWindow, NULL);
+	}
 
 	release(this->subviews);
 
+	release(this->constraints);
+
+	free(this->identifier);
+
+	if (this->layer) {
+		$(this->layerRenderer, deleteTexture, this->layer);
+		release(this->layerRenderer);
+	}
+
 	super(Object, self, dealloc);
 }
 
@@ -106,8 +598,9 @@ static void addConstraint(View *self, Constraint *constraint) {
 
 	$(self->constraints, addObject, constraint);
 
-	self->needsLayout = true;
 	self->needsApplyConstraints = true;
+
+	$(self, setNeedsLayout);
 }
 
 /**
@@ -144,6 +637,10 @@ static void addSubviewRelativeTo(View *self, View *subview, View *other, ViewPos
 
 	$(subview, removeFromSuperview);
 
+	if (subview->constraintSolver) {
+		resetConstraintSolver(subview);
+	}
+
 	if (other && other->superview == self) {
 
 		const Array *subviews = (Array *) self->subviews;
@@ -166,9 +663,15 @@ static void addSubviewRelativeTo(View *self, View *subview, View *other, ViewPos
 
 	subview->superview = self;
 
+	hierarchyDidAddSubview(subview, false);
+
 	$(subview, setWindow, self->window);
 
-	self->needsLayout = true;
+	$(self, setNeedsLayout);
+
+	MVC_InvalidateRenderFrames();
+
+	$(self, setNeedsDisplay);
 }
 
 /**
@@ -192,29 +695,40 @@ static View *ancestorWithIdentifier(const View *self, const char *identifier) {
 	return NULL;
 }
 
-/**
- * @brief Comparator for applyConstraints sorting.
- */
-static Order applyConstraints_comparator(const ident obj1, const ident obj2) {
-	return ((Constraint *) obj1)->priority - ((Constraint *) obj2)->priority;
-}
-
 /**
  * @fn void View::applyConstraints(View *self)
  * @memberof View
  */
 static void applyConstraints(View *self) {
 
-	$(self->constraints, sort, applyConstraints_comparator);
-
 	const Array *constraints = (Array *) self->constraints;
+	if (constraints->count == 0) {
+		return;
+	}
+
+	MVC_TraceBegin("applyConstraints");
+
+	View *root = rootView(self);
+	if (root->constraintSolver == NULL) {
+		root->constraintSolver = $(alloc(ConstraintSolver), init);
+		assert(root->constraintSolver);
+	}
+
 	for (size_t i = 0; i < constraints->count; i++) {
 
-		const Constraint *constraint = $(constraints, objectAtIndex, i);
+		Constraint *constraint = $(constraints, objectAtIndex, i);
 		if (constraint->enabled) {
-			$(constraint, apply, self);
+			if (constraint->solverConstraint == 0) {
+				bindConstraint(root, self, constraint);
+			}
+		} else {
+			if (constraint->solverConstraint) {
+				unbindConstraint(root, self, constraint);
+			}
 		}
 	}
+
+	MVC_TraceEnd("applyConstraints");
 }
 
 /**
@@ -236,7 +750,9 @@ static void applyConstraintsIfNeeded(View *self) {
 
 	self->needsApplyConstraints = false;
 
-	$((Array *) self->subviews, enumerateObjects, applyConstraintsIfNeeded_recurse, NULL);
+	if (self->descendantsNeedLayout) {
+		$((Array *) self->subviews, enumerateObjects, applyConstraintsIfNeeded_recurse, NULL);
+	}
 }
 
 /**
@@ -255,13 +771,14 @@ static void awakeWithDictionary(View *self, const Dictionary *dictionary) {
 		MakeInlet("constraints", InletTypeConstraints, &self, NULL),
 		MakeInlet("frame", InletTypeRectangle, &self->frame, NULL),
 		MakeInlet("hidden", InletTypeBool, &self->hidden, NULL),
+		MakeInlet("layerBacked", InletTypeBool, &self->layerBacked, NULL),
 		MakeInlet("padding", InletTypeRectangle, &self->padding, NULL),
 		MakeInlet("subviews", InletTypeSubviews, &self, NULL)
 	);
 
 	$(self, bind, inlets, dictionary);
 
-	if (self->identifier) {
+	if (self->identifier && _outlets) {
 		for (Outlet *outlet = _outlets; outlet->identifier; outlet++) {
 			if (strcmp(outlet->identifier, self->identifier) == 0) {
 				*outlet->view = self;
@@ -278,6 +795,7 @@ static void becomeFirstResponder(View *self) {
 
 	if (self->window) {
 		MVC_MakeFirstResponder(self->window, self);
+		$(self, setNeedsDisplay);
 	} else {
 		MVC_LogWarn("%s: window is NULL\n", (self->identifier ?: self->object.clazz->name));
 	}
@@ -332,22 +850,30 @@ static void bringSubviewToFront(View *self, View *subview) {
 }
 
 /**
- * @fn SDL_Rect View::clippingFrame(const View *self)
- * @memberof View
+ * @return The View's render frame, expanded for its border.
  */
-static SDL_Rect clippingFrame(const View *self) {
+static SDL_Rect borderFrame(const View *self) {
 
 	SDL_Rect frame = $(self, renderFrame);
 
 	if (self->borderWidth && self->borderColor.a) {
-		for (int i = 0; i < self->borderWidth; i++) {
-			frame.x -= 1;
-			frame.y -= 1;
-			frame.w += 2;
-			frame.h += 2;
-		}
+		frame.x -= self->borderWidth;
+		frame.y -= self->borderWidth;
+		frame.w += self->borderWidth * 2;
+		frame.h += self->borderWidth * 2;
 	}
 
+	return frame;
+}
+
+/**
+ * @fn SDL_Rect View::clippingFrame(const View *self)
+ * @memberof View
+ */
+static SDL_Rect clippingFrame(const View *self) {
+
+	SDL_Rect frame = borderFrame(self);
+
 	const View *superview = self->superview;
 	while (superview) {
 		if (superview->clipsSubviews) {
@@ -365,8 +891,8 @@ static SDL_Rect clippingFrame(const View *self) {
 				}
 
 				frame.w = frame.h = 0;
-				break;
 			}
+			break;
 		}
 		superview = superview->superview;
 	}
@@ -460,24 +986,125 @@ static _Bool didReceiveEvent(const View *self, const SDL_Event *event) {
 }
 
 /**
- * @fn Array *View::draw(View *self)
+ * @fn void View::draw(View *self, Renderer *renderer)
  * @memberof View
  */
 static void draw(View *self, Renderer *renderer) {
 
 	assert(self->window);
 
-	if (self->hidden == false) {
-		$(renderer, drawView, self);
+	const View *superview = self->superview;
+	while (superview) {
+		if (superview->clipsSubviews) {
+			break;
+		}
+		superview = superview->superview;
+	}
 
-		const Array *subviews = (Array *) self->subviews;
-		for (size_t i = 0; i < subviews->count; i++) {
-			View *subview = $(subviews, objectAtIndex, i);
-			if ($(subview, isFirstResponder) == false) {
+	SDL_Rect clip;
+	if (superview) {
+		clip = $(superview, clippingFrame);
+		if (clip.w == 0 || clip.h == 0) {
+			return;
+		}
+	} else {
+		clip = renderer->damage;
+	}
+
+	if (SDL_IntersectRect(&clip, &renderer->damage, &clip)) {
+		$(self, drawWithClip, renderer, &clip);
+	}
+}
+
+/**
+ * @fn void View::drawWithClip(View *self, Renderer *renderer, const SDL_Rect *clip)
+ * @memberof View
+ */
+static void drawWithClip(View *self, Renderer *renderer, const SDL_Rect *clip) {
+
+	if (self->hidden) {
+		return;
+	}
+
+	SDL_Rect frame = borderFrame(self);
+	if (clip && SDL_IntersectRect(clip, &frame, &frame) == false) {
+		frame.w = frame.h = 0;
+	}
+
+	SDL_Rect layerFrame = MakeRect(0, 0, 0, 0);
+	if (self->layerBacked && frame.w && frame.h) {
+
+		SDL_Rect window = MakeRect(0, 0, 0, 0);
+		SDL_GetWindowSize(self->window, &window.w, &window.h);
+
+		layerFrame = $(self, clippingFrame);
+		if (SDL_IntersectRect(&window, &layerFrame, &layerFrame) == false) {
+			layerFrame.w = layerFrame.h = 0;
+		}
+
+		if (self->layer && self->layerRenderer == renderer && SDL_RectEquals(&layerFrame, &self->layerFrame)) {
+
+			const GLfloat texcoords[] = { 0.0, 1.0, 1.0, 0.0 };
+
+			$(renderer, setClippingFrame, &frame);
+			$(renderer, drawTextureRegion, self->layer, texcoords, &layerFrame);
+
+			renderer->stats.viewsDrawn++;
+
+			self->needsDisplay = false;
+			return;
+		}
+	}
+
+	if (frame.w && frame.h) {
+		if (renderer->interface->drawView == ((RendererInterface *) _Renderer()->def->interface)->drawView) {
+			$(renderer, setClippingFrame, &frame);
+			$(self, render, renderer);
+		} else {
+			$(renderer, drawView, self);
+		}
+
+		renderer->stats.viewsDrawn++;
+	} else {
+		renderer->stats.viewsCulled++;
+	}
+
+	self->needsDisplay = false;
+
+	if (self->clipsSubviews) {
+		if (frame.w == 0 || frame.h == 0) {
+			return;
+		}
+		clip = &frame;
+	}
+
+	const Array *subviews = (Array *) self->subviews;
+	for (size_t i = 0; i < subviews->count; i++) {
+		View *subview = $(subviews, objectAtIndex, i);
+		if ($(subview, isFirstResponder) == false) {
+			if (subview->interface->draw == draw) {
+				$(subview, drawWithClip, renderer, clip);
+			} else {
 				$(subview, draw, renderer);
 			}
 		}
 	}
+
+	if (self->layerBacked && frame.w && frame.h && SDL_RectEquals(&frame, &layerFrame)) {
+
+		if (self->layer) {
+			$(self->layerRenderer, deleteTexture, self->layer);
+			release(self->layerRenderer);
+			self->layerRenderer = NULL;
+		}
+
+		self->layer = $(renderer, createTextureWithFramebuffer, &layerFrame);
+		self->layerFrame = layerFrame;
+
+		if (self->layer) {
+			self->layerRenderer = retain(renderer);
+		}
+	}
 }
 
 /**
@@ -585,6 +1212,24 @@ static _Bool isVisible(const View *self) {
 	return true;
 }
 
+/**
+ * @fn _Bool View::isVisibleSubview(const View *self, const View *subview)
+ * @memberof View
+ */
+static _Bool isVisibleSubview(const View *self, const View *subview) {
+
+	if (self->interface->visibleSubviews != ((ViewInterface *) _View()->def->interface)->visibleSubviews) {
+
+		Array *subviews = $(self, visibleSubviews);
+		const _Bool visible = $(subviews, containsObject, (ident) subview);
+
+		release(subviews);
+		return visible;
+	}
+
+	return subview->hidden == false && subview->alignment != ViewAlignmentInternal;
+}
+
 /**
  * @brief ArrayEnumerator for layoutIfNeeded recursion.
  */
@@ -593,20 +1238,74 @@ static void layoutIfNeeded_recurse(const Array *array, ident obj, ident data) {
 }
 
 /**
- * @fn void View::layoutIfNeeded(View *self)
- * @memberof View
+ * @brief Lays out the given View and its dirty descendants.
+ * @return True if any layout was performed, false if the View was clean.
  */
-static void layoutIfNeeded(View *self) {
+static _Bool layoutIfNeeded_pass(View *self) {
+
+	const _Bool dirty = self->needsLayout || self->needsApplyConstraints;
+	if (dirty == false && self->descendantsNeedLayout == false) {
+		return false;
+	}
+
+	if (dirty) {
+		$(self, setNeedsDisplay);
+	}
 
 	if (self->needsLayout) {
+		MVC_TraceBegin("layoutSubviews");
 		$(self, layoutSubviews);
+		MVC_TraceEnd("layoutSubviews");
 	}
 
 	self->needsLayout = false;
 
 	$(self, applyConstraintsIfNeeded);
 
+	if (dirty) {
+		invalidateMeasurements(self);
+		$(self, setNeedsDisplay);
+	}
+
+	self->descendantsNeedLayout = false;
+
 	$((Array *) self->subviews, enumerateObjects, layoutIfNeeded_recurse, NULL);
+
+	const Array *subviews = (Array *) self->subviews;
+	for (size_t i = 0; i < subviews->count; i++) {
+
+		const View *subview = $(subviews, objectAtIndex, i);
+		if (subview->needsLayout || subview->needsApplyConstraints || subview->descendantsNeedLayout) {
+			self->descendantsNeedLayout = true;
+			break;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @fn void View::layoutIfNeeded(View *self)
+ * @memberof View
+ */
+static void layoutIfNeeded(View *self) {
+
+	if (self->superview == NULL) {
+		if (self->needsLayout || self->needsApplyConstraints || self->descendantsNeedLayout) {
+			MVC_InvalidateMeasurements();
+		}
+	}
+
+	if (layoutIfNeeded_pass(self) && self->superview == NULL) {
+
+		for (int i = 0; self->constraintSolver && i < MAX_CONSTRAINT_PASSES; i++) {
+			if (solveConstraints(self) == false) {
+				break;
+			}
+
+			layoutIfNeeded_pass(self);
+		}
+	}
 }
 
 /**
@@ -684,6 +1383,8 @@ static void layoutSubviews(View *self) {
 				break;
 		}
 	}
+
+	MVC_InvalidateRenderFrames();
 }
 
 /**
@@ -722,9 +1423,15 @@ static void removeAllSubviews(View *self) {
  */
 static void removeConstraint(View *self, Constraint *constraint) {
 
+	if (constraint->solverConstraint) {
+		unbindConstraint(rootView(self), self, constraint);
+	}
+
 	$(self->constraints, removeObject, constraint);
 
 	self->needsApplyConstraints = true;
+
+	setAncestorsNeedLayout(self);
 }
 
 /**
@@ -748,13 +1455,28 @@ static void removeSubview(View *self, View *subview) {
 
 	if (subview->superview == self) {
 
+		View *root = rootView(self);
+		if (root->constraintSolver && isConstrained(subview)) {
+			unbindSubview(root, subview);
+		}
+
+		$(subview, setNeedsDisplay);
+
+		retain(subview);
+
 		$(self->subviews, removeObject, subview);
 
 		subview->superview = NULL;
 
+		_hierarchyGeneration++;
+
 		$(subview, setWindow, NULL);
 
-		self->needsLayout = true;
+		release(subview);
+
+		$(self, setNeedsLayout);
+
+		MVC_InvalidateRenderFrames();
 	}
 }
 
@@ -803,6 +1525,17 @@ static void renderDeviceDidReset_recurse(const Array *array, ident obj, ident da
  * @memberof View
  */
 static void renderDeviceDidReset(View *self) {
+
+	if (self->layer) {
+		release(self->layerRenderer);
+		self->layerRenderer = NULL;
+	}
+
+	self->layer = 0;
+	self->layerFrame = MakeRect(0, 0, 0, 0);
+
+	MVC_InvalidateMeasurements();
+
 	$((Array *) self->subviews, enumerateObjects, renderDeviceDidReset_recurse, NULL);
 }
 
@@ -812,24 +1545,34 @@ static void renderDeviceDidReset(View *self) {
  */
 static SDL_Rect renderFrame(const View *self) {
 
-	SDL_Rect frame = self->frame;
+	View *this = (View *) self;
 
-	const View *view = self;
-	const View *superview = view->superview;
-	while (superview) {
+	if (this->renderGeneration != _renderGeneration) {
 
-		frame.x += superview->frame.x;
-		frame.y += superview->frame.y;
+		this->renderOrigin = MakePoint(0, 0);
 
-		if (view->alignment != ViewAlignmentInternal) {
-			frame.x += superview->padding.left;
-			frame.y += superview->padding.top;
+		const View *superview = self->superview;
+		if (superview) {
+
+			const SDL_Rect superviewFrame = $(superview, renderFrame);
+
+			this->renderOrigin.x = superviewFrame.x;
+			this->renderOrigin.y = superviewFrame.y;
+
+			if (self->alignment != ViewAlignmentInternal) {
+				this->renderOrigin.x += superview->padding.left;
+				this->renderOrigin.y += superview->padding.top;
+			}
 		}
 
-		view = superview;
-		superview = view->superview;
+		this->renderGeneration = _renderGeneration;
 	}
 
+	SDL_Rect frame = self->frame;
+
+	frame.x += self->renderOrigin.x;
+	frame.y += self->renderOrigin.y;
+
 	return frame;
 }
 
@@ -854,6 +1597,7 @@ static void resignFirstResponder(View *self) {
 
 	if ($(self, isFirstResponder)) {
 		MVC_MakeFirstResponder(self->window, NULL);
+		$(self, setNeedsDisplay);
 	}
 }
 
@@ -889,10 +1633,16 @@ static void resize(View *self, const SDL_Size *size) {
 
 	if (self->frame.w != size->w || self->frame.h != size->h) {
 
+		$(self, setNeedsDisplay);
+
 		self->frame.w = size->w;
 		self->frame.h = size->h;
 
-		self->needsLayout = true;
+		$(self, setNeedsLayout);
+
+		MVC_InvalidateRenderFrames();
+
+		$(self, setNeedsDisplay);
 
 		$((Array *) self->subviews, enumerateObjects, resize_recurse, NULL);
 	}
@@ -915,6 +1665,50 @@ static void respondToEvent(View *self, const SDL_Event *event) {
 	}
 }
 
+/**
+ * @fn void View::setNeedsDisplay(View *self)
+ * @memberof View
+ */
+static void setNeedsDisplay(View *self) {
+
+	self->needsDisplay = true;
+
+	const View *damaged = self;
+
+	for (View *view = self; view; view = view->superview) {
+		if (view->layerBacked) {
+			view->layerFrame = MakeRect(0, 0, 0, 0);
+			damaged = view;
+		}
+	}
+
+	WindowController *windowController = MVC_WindowController(self->window);
+	if (windowController) {
+
+		const SDL_Rect frame = $(damaged, clippingFrame);
+		if (frame.w && frame.h) {
+			$(windowController, setNeedsRenderInRect, &frame);
+		}
+	}
+}
+
+/**
+ * @fn void View::setNeedsLayout(View *self)
+ * @memberof View
+ */
+static void setNeedsLayout(View *self) {
+
+	self->needsLayout = true;
+
+	if (((Array *) self->constraints)->count) {
+		self->needsApplyConstraints = true;
+	}
+
+	setAncestorsNeedLayout(self);
+
+	invalidateMeasurements(self);
+}
+
 /**
  * @brief ArrayEnumerator for setWindow recursion.
  */
@@ -943,6 +1737,10 @@ static void setWindow(View *self, SDL_Window *window) {
 	}
 
 	$((Array *) self->subviews, enumerateObjects, setWindow_recurse, window);
+
+	if (self->window && self->superview == NULL) {
+		$(self, setNeedsDisplay);
+	}
 }
 
 /**
@@ -959,10 +1757,18 @@ static SDL_Size size(const View *self) {
  */
 static SDL_Size sizeThatContains(const View *self) {
 
-	const SDL_Size size = $(self, size);
-	const SDL_Size sizeThatFits = $(self, sizeThatFits);
+	View *this = (View *) self;
 
-	return MakeSize(max(size.w, sizeThatFits.w), max(size.h, sizeThatFits.h));
+	if (this->measureGeneration != _measureGeneration) {
+
+		const SDL_Size size = $(self, size);
+		const SDL_Size sizeThatFits = $(self, sizeThatFits);
+
+		this->measuredSize = MakeSize(max(size.w, sizeThatFits.w), max(size.h, sizeThatFits.h));
+		this->measureGeneration = _measureGeneration;
+	}
+
+	return this->measuredSize;
 }
 
 /**
@@ -984,10 +1790,14 @@ static SDL_Size sizeThatFits(const View *self) {
 	if (self->autoresizingMask & ViewAutoresizingContain) {
 		size = MakeSize(0, 0);
 
-		Array *subviews = $(self, visibleSubviews);
+		const Array *subviews = (Array *) self->subviews;
 		for (size_t i = 0; i < subviews->count; i++) {
 
 			const View *subview = $(subviews, objectAtIndex, i);
+			if ($(self, isVisibleSubview, subview) == false) {
+				continue;
+			}
+
 			const SDL_Size subviewSize = $(subview, sizeThatContains);
 
 			SDL_Point subviewOrigin = MakePoint(0, 0);
@@ -1005,8 +1815,6 @@ static SDL_Size sizeThatFits(const View *self) {
 
 		size.w += self->padding.left + self->padding.right;
 		size.h += self->padding.top + self->padding.bottom;
-
-		release(subviews);
 	}
 
 	return size;
@@ -1069,6 +1877,9 @@ static void updateBindings_recurse(const Array *array, ident obj, ident data) {
  * @memberof View
  */
 static void updateBindings(View *self) {
+
+	$(self, setNeedsDisplay);
+
 	$((Array *) self->subviews, enumerateObjects, updateBindings_recurse, NULL);
 }
 
@@ -1091,11 +1902,13 @@ static SDL_Rect viewport(const View *self) {
  */
 static View *viewWithContentsOfFile(const char *path, Outlet *outlets) {
 
-	Data *data = $$(Data, dataWithContentsOfFile, path);
-
-	View *view = $$(View, viewWithData, data, outlets);
+	View *view = NULL;
 
-	release(data);
+	Dictionary *dictionary = MVC_ReadViewDescription(path);
+	if (dictionary) {
+		view = $$(View, viewWithDictionary, dictionary, outlets);
+		release(dictionary);
+	}
 
 	return view;
 }
@@ -1106,7 +1919,12 @@ static View *viewWithContentsOfFile(const char *path, Outlet *outlets) {
  */
 static View *viewWithData(const Data *data, Outlet *outlets) {
 
-	Dictionary *dictionary = $$(JSONSerialization, objectFromData, data, 0);
+	Dictionary *dictionary;
+	if (MVC_IsCompiledViewDescription(data->bytes, data->length)) {
+		dictionary = MVC_DecodeViewDescription(data->bytes, data->length);
+	} else {
+		dictionary = $$(JSONSerialization, objectFromData, data, 0);
+	}
 
 	View *view = $$(View, viewWithDictionary, dictionary, outlets);
 
@@ -1145,6 +1963,8 @@ static View *viewWithDictionary(const Dictionary *dictionary, Outlet *outlets) {
 		_initialize(_TextView());
 	});
 
+	MVC_TraceBegin("viewWithDictionary");
+
 	_outlets = outlets;
 
 	View *view = NULL;
@@ -1157,17 +1977,25 @@ static View *viewWithDictionary(const Dictionary *dictionary, Outlet *outlets) {
 		}
 	}
 
+	MVC_TraceEnd("viewWithDictionary");
+
 	return view;
 }
 
 /**
  * @brief Predicate for visibleSubviews.
+ * @remarks View::isVisibleSubview is consulted only if it is overridden, as the default
+ * implementation defers to overrides of View::visibleSubviews, which may call this one.
  */
 static _Bool visibleSubviews_filter(ident obj, ident data) {
 
-	const View *view = (View *) obj;
+	const View *self = data, *subview = obj;
+
+	if (self->interface->isVisibleSubview != ((ViewInterface *) _View()->def->interface)->isVisibleSubview) {
+		return $(self, isVisibleSubview, subview);
+	}
 
-	return view->hidden == false && view->alignment != ViewAlignmentInternal;
+	return subview->hidden == false && subview->alignment != ViewAlignmentInternal;
 }
 
 /**
@@ -1175,7 +2003,7 @@ static _Bool visibleSubviews_filter(ident obj, ident data) {
  * @memberof View
  */
 static Array *visibleSubviews(const View *self) {
-	return $((Array *) self->subviews, filteredArray, visibleSubviews_filter, NULL);
+	return $((Array *) self->subviews, filteredArray, visibleSubviews_filter, (ident) self);
 }
 
 #pragma mark - View class methods
@@ -1208,12 +2036,14 @@ static void initialize(Class *clazz) {
 	((ViewInterface *) clazz->def->interface)->descendantWithIdentifier = descendantWithIdentifier;
 	((ViewInterface *) clazz->def->interface)->didReceiveEvent = didReceiveEvent;
 	((ViewInterface *) clazz->def->interface)->draw = draw;
+	((ViewInterface *) clazz->def->interface)->drawWithClip = drawWithClip;
 	((ViewInterface *) clazz->def->interface)->hitTest = hitTest;
 	((ViewInterface *) clazz->def->interface)->init = init;
 	((ViewInterface *) clazz->def->interface)->initWithFrame = initWithFrame;
 	((ViewInterface *) clazz->def->interface)->isDescendantOfView = isDescendantOfView;
 	((ViewInterface *) clazz->def->interface)->isFirstResponder = isFirstResponder;
 	((ViewInterface *) clazz->def->interface)->isVisible = isVisible;
+	((ViewInterface *) clazz->def->interface)->isVisibleSubview = isVisibleSubview;
 	((ViewInterface *) clazz->def->interface)->layoutIfNeeded = layoutIfNeeded;
 	((ViewInterface *) clazz->def->interface)->layoutSubviews = layoutSubviews;
 	((ViewInterface *) clazz->def->interface)->removeAllConstraints = removeAllConstraints;
@@ -1228,6 +2058,8 @@ static void initialize(Class *clazz) {
 	((ViewInterface *) clazz->def->interface)->resignFirstResponder = resignFirstResponder;
 	((ViewInterface *) clazz->def->interface)->resize = resize;
 	((ViewInterface *) clazz->def->interface)->respondToEvent = respondToEvent;
+	((ViewInterface *) clazz->def->interface)->setNeedsDisplay = setNeedsDisplay;
+	((ViewInterface *) clazz->def->interface)->setNeedsLayout = setNeedsLayout;
 	((ViewInterface *) clazz->def->interface)->setWindow = setWindow;
 	((ViewInterface *) clazz->def->interface)->size = size;
 	((ViewInterface *) clazz->def->interface)->sizeThatContains = sizeThatContains;
@@ -1291,3 +2123,21 @@ View *MVC_FirstResponder(SDL_Window *window) {
 	
 	return SDL_GetWindowData(window, MVC_FIRST_RESPONDER);
 }
+
+void MVC_InvalidateMeasurements(void) {
+
+	_measureGeneration++;
+
+	if (_measureGeneration == 0) {
+		_measureGeneration++;
+	}
+}
+
+void MVC_InvalidateRenderFrames(void) {
+
+	_renderGeneration++;
+
+	if (_renderGeneration == 0) {
+		_renderGeneration++;
+	}
+}
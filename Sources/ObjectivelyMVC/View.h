@@ -30,6 +30,7 @@
 
 #include <ObjectivelyMVC/Colors.h>
 #include <ObjectivelyMVC/Constraint.h>
+#include <ObjectivelyMVC/ConstraintSolver.h>
 #include <ObjectivelyMVC/Renderer.h>
 #include <ObjectivelyMVC/View+JSON.h>
 
@@ -78,6 +79,38 @@ typedef enum {
 
 OBJECTIVELYMVC_EXPORT const EnumName ViewAutoresizingNames[];
 
+/**
+ * @brief The components of a View's frame, as bound to a ConstraintSolver.
+ */
+typedef enum {
+	ViewFrameX,
+	ViewFrameY,
+	ViewFrameWidth,
+	ViewFrameHeight,
+	ViewFrameComponents
+} ViewFrameComponent;
+
+/**
+ * @brief A component of a View's frame, bound to the ConstraintSolver of its hierarchy.
+ */
+typedef struct {
+
+	/**
+	 * @brief The variable, or 0 if unbound.
+	 */
+	SolverVariable variable;
+
+	/**
+	 * @brief The count of bound Constraints reading this component.
+	 */
+	unsigned int sources;
+
+	/**
+	 * @brief The count of bound Constraints targeting this component.
+	 */
+	unsigned int targets;
+} ViewFrameVariable;
+
 /**
  * @brief Spacing applied to the inside of a View's frame.
  */
@@ -146,18 +179,45 @@ struct View {
 	 */
 	_Bool clipsSubviews;
 
+	/**
+	 * @brief The Views bound to `constraintSolver`, linked via `nextConstrainedView`.
+	 * @private
+	 */
+	View *constrainedViews;
+
+	/**
+	 * @brief The ConstraintSolver of this View hierarchy, if this View is its root.
+	 * @private
+	 */
+	ConstraintSolver *constraintSolver;
+
 	/**
 	 * @brief The Constraints held on this View.
 	 */
 	MutableArray *constraints;
 
+	/**
+	 * @brief If true, a descendant of this View needs layout or to apply its Constraints.
+	 * @remarks Set via View::setNeedsLayout, so that layout descends only into dirty branches.
+	 * @private
+	 */
+	_Bool descendantsNeedLayout;
+
 	/**
 	 * @brief The frame, relative to the superview.
 	 */
 	SDL_Rect frame;
 
+	/**
+	 * @brief The components of `frame` bound to the ConstraintSolver of this View's hierarchy.
+	 * @private
+	 */
+	ViewFrameVariable frameVariables[ViewFrameComponents];
+
 	/**
 	 * @brief If `true`, this View is not drawn.
+	 * @remarks Call View::setNeedsLayout after changing this outside of View::layoutSubviews, so
+	 * that the superview is measured and laid out again.
 	 */
 	_Bool hidden;
 
@@ -167,21 +227,85 @@ struct View {
 	 */
 	char *identifier;
 
+	/**
+	 * @brief The cached rendering of this View and its descendants, if `layerBacked`.
+	 * @private
+	 */
+	GLuint layer;
+
+	/**
+	 * @brief If true, this View and its descendants are rendered once to a texture, which is
+	 * drawn in their place until View::setNeedsDisplay is called on any View in the subtree.
+	 * @remarks The texture is captured from the framebuffer, so layer-backed Views should have
+	 * an opaque background. The first responder is never drawn from the layer.
+	 */
+	_Bool layerBacked;
+
+	/**
+	 * @brief The clipping frame at which `layer` was captured, or empty if `layer` is stale.
+	 * @private
+	 */
+	SDL_Rect layerFrame;
+
+	/**
+	 * @brief The Renderer that created `layer`.
+	 * @private
+	 */
+	Renderer *layerRenderer;
+
+	/**
+	 * @brief The measurement generation at which `measuredSize` was resolved, or 0 if stale.
+	 * @private
+	 */
+	unsigned int measureGeneration;
+
+	/**
+	 * @brief The cached result of View::sizeThatContains.
+	 * @private
+	 */
+	SDL_Size measuredSize;
+
 	/**
 	 * @brief If true, this View will apply Constraints before it is drawn.
+	 * @remarks Set via View::setNeedsLayout.
 	 */
 	_Bool needsApplyConstraints;
 
+	/**
+	 * @brief If true, this View has changed since it was last drawn.
+	 * @remarks Set via View::setNeedsDisplay, and cleared as this View is drawn.
+	 */
+	_Bool needsDisplay;
+
 	/**
 	 * @brief If true, this View will layout its subviews before it is drawn.
+	 * @remarks Set via View::setNeedsLayout.
 	 */
 	_Bool needsLayout;
 
+	/**
+	 * @brief The next View bound to the ConstraintSolver of this View's hierarchy.
+	 * @private
+	 */
+	View *nextConstrainedView;
+
 	/**
 	 * @brief The padding.
 	 */
 	ViewPadding padding;
 
+	/**
+	 * @brief The render frame generation at which `renderOrigin` was resolved.
+	 * @private
+	 */
+	unsigned int renderGeneration;
+
+	/**
+	 * @brief The cached offset of `frame` in object space, accumulated from the superview chain.
+	 * @private
+	 */
+	SDL_Point renderOrigin;
+
 	/**
 	 * @brief The immediate subviews.
 	 */
@@ -273,8 +397,12 @@ struct ViewInterface {
 
 	/**
 	 * @fn void View::applyConstraints(View *self)
-	 * @brief Applies all Constraints on this View before laying out its subviews.
+	 * @brief Adds this View's enabled Constraints to the ConstraintSolver of its hierarchy, and
+	 * removes its disabled ones.
 	 * @param self The View.
+	 * @remarks Constraints are solved together, honoring their relations and priorities, each
+	 * time the root View of the hierarchy is laid out. Frame components that are not targeted by
+	 * a Constraint hold their current values.
 	 * @memberof View
 	 */
 	void (*applyConstraints)(View *self);
@@ -283,6 +411,7 @@ struct ViewInterface {
 	 * @fn void View::applyConstraintsIfNeeded(View *self)
 	 * @brief Recursively applies Constraints against this View and its subviews.
 	 * @param self The View.
+	 * @remarks Only subtrees marked via View::setNeedsLayout are visited.
 	 * @memberof View
 	 */
 	void (*applyConstraintsIfNeeded)(View *self);
@@ -394,13 +523,30 @@ struct ViewInterface {
 	 * @brief Draws this View.
 	 * @param self The View.
 	 * @param renderer The Renderer.
-	 * @remarks This method determines if the View is visible and dispatches Renderer::drawView
-	 * before recursing down the View hierarchy. Rasterization is performed in View::render.
+	 * @remarks This method resolves the clipping frame of the nearest clipping ancestor,
+	 * restricted to the Renderer's damaged region, and invokes View::drawWithClip with it.
+	 * Rasterization is performed in View::render.
+	 * @see View::drawWithClip(View *, Renderer *, const SDL_Rect *)
 	 * @see View::render(View *, Renderer *)
 	 * @memberof View
 	 */
 	void (*draw)(View *self, Renderer *renderer);
 
+	/**
+	 * @fn void View::drawWithClip(View *self, Renderer *renderer, const SDL_Rect *clip)
+	 * @brief Draws this View and its descendants within the given clipping frame.
+	 * @param self The View.
+	 * @param renderer The Renderer.
+	 * @param clip The clipping frame of the nearest clipping ancestor, or `NULL`.
+	 * @remarks This method determines if the View is visible, sets the Renderer's clipping frame
+	 * and invokes View::render before recursing down the View hierarchy, carrying the clipping
+	 * frame down the traversal. Subtrees of clipping Views that are fully clipped are skipped.
+	 * @remarks Subviews that override View::draw, and Renderers that override Renderer::drawView,
+	 * are dispatched to, at the cost of resolving their clipping frame from their ancestors.
+	 * @memberof View
+	 */
+	void (*drawWithClip)(View *self, Renderer *renderer, const SDL_Rect *clip);
+
 	/**
 	 * @fn View *View::hitTest(const View *self, const SDL_Point *point)
 	 * @brief Performs a hit test against this View and its descendants for the given point.
@@ -459,10 +605,28 @@ struct ViewInterface {
 	 */
 	_Bool (*isVisible)(const View *self);
 
+	/**
+	 * @fn _Bool View::isVisibleSubview(const View *self, const View *subview)
+	 * @param self The View.
+	 * @param subview A subview of this View.
+	 * @return True if `subview` participates in this View's layout and measurement.
+	 * @remarks The default implementation excludes hidden subviews and those that specify
+	 * ViewAlignmentInternal. Layout and measurement iterate `subviews` with this predicate, rather
+	 * than allocating an Array via View::visibleSubviews.
+	 * @remarks If View::visibleSubviews is overridden, the default implementation instead tests
+	 * membership in the Array it returns, so that existing overrides continue to affect layout.
+	 * Subclasses should override this method instead, which avoids that allocation, and should
+	 * not override both.
+	 * @memberof View
+	 */
+	_Bool (*isVisibleSubview)(const View *self, const View *subview);
+
 	/**
 	 * @fn void View::layoutIfNeeded(View *self)
 	 * @brief Recursively updates the layout of this View and its subviews.
 	 * @param self The View.
+	 * @remarks Only subtrees marked via View::setNeedsLayout are visited, so a clean hierarchy is
+	 * laid out in constant time.
 	 * @memberof View
 	 */
 	void (*layoutIfNeeded)(View *self);
@@ -542,6 +706,8 @@ struct ViewInterface {
 	 * @fn SDL_Frame View::renderFrame(const View *self)
 	 * @param self The View.
 	 * @return This View's absolute frame in the View hierarchy, in object space.
+	 * @remarks The offset contributed by the superview chain is cached until the next call to
+	 * MVC_InvalidateRenderFrames, so that each View resolves it from its superview's cache.
 	 * @memberof View
 	 */
 	SDL_Rect (*renderFrame)(const View *self);
@@ -582,6 +748,30 @@ struct ViewInterface {
 	 */
 	void (*respondToEvent)(View *self, const SDL_Event *event);
 
+	/**
+	 * @fn void View::setNeedsDisplay(View *self)
+	 * @brief Marks this View as needing to be drawn on the next frame.
+	 * @param self The View.
+	 * @remarks This View's clipping frame is added to the damaged region of the WindowController
+	 * managing its window. Built-in setters, layout and Control state changes call this method
+	 * automatically. Applications that modify a View's fields directly (e.g. `hidden` or
+	 * `backgroundColor`) should call it themselves, on the superview if this View is being hidden.
+	 * @see WindowController::needsRender
+	 * @memberof View
+	 */
+	void (*setNeedsDisplay)(View *self);
+
+	/**
+	 * @fn void View::setNeedsLayout(View *self)
+	 * @brief Marks this View as needing layout on the next frame.
+	 * @param self The View.
+	 * @remarks Each ancestor of this View is marked via `descendantsNeedLayout`, so that
+	 * View::layoutIfNeeded skips clean subtrees. Subclasses should call this method rather than
+	 * setting `needsLayout` directly.
+	 * @memberof View
+	 */
+	void (*setNeedsLayout)(View *self);
+
 	/**
 	 * @fn void View::setWindow(View *self, SDL_Window *window)
 	 * @brief Sets the window associated with this View.
@@ -604,7 +794,9 @@ struct ViewInterface {
 	 * @fn SDL_Size View::sizeThatContains(const View *self)
 	 * @param self The View.
 	 * @return An SDL_Size that contains this View's subviews.
-	 * @remarks The returned size is greater than or equal to View::sizeThatFits.
+	 * @remarks The returned size is greater than or equal to View::sizeThatFits. It is cached
+	 * until this View or one of its descendants is resized or laid out, or until the next layout
+	 * pass of its root View begins, so that measuring a View hierarchy is linear in its size.
 	 * @memberof View
 	 */
 	SDL_Size (*sizeThatContains)(const View *self);
@@ -667,9 +859,10 @@ struct ViewInterface {
 	 * @static
 	 * @fn View *View::viewWithContentsOfFile(const char *path, Outlet *outlets)
 	 * @brief Instantiates a View initialized with the contents of the JSON file at `path`.
-	 * @param path A path to a JSON file describing a View.
+	 * @param path A path to a JSON file, or compiled View description, describing a View.
 	 * @param outlets An optional array of Outlets to resolve.
 	 * @return The initialized View, or `NULL` on error.
+	 * @remarks Compiled View descriptions are memory-mapped where supported.
 	 * @memberof View
 	 */
 	View *(*viewWithContentsOfFile)(const char *path, Outlet *outlets);
@@ -678,7 +871,7 @@ struct ViewInterface {
 	 * @static
 	 * @fn View *View::viewWithData(const Data *data, Outlet *outlets)
 	 * @brief Instantiates a View initialized with the contents of `data`.
-	 * @param data A Data containing JSON describing a View.
+	 * @param data A Data containing JSON, or a compiled View description, describing a View.
 	 * @param outlets An optional array of Outlets to resolve.
 	 * @return The initialized View, or `NULL` on error.
 	 * @memberof View
@@ -701,7 +894,7 @@ struct ViewInterface {
 	 * @fn Array *View::visibleSubviews(const View *self)
 	 * @param self The View.
 	 * @return An Array of this View's visible subviews.
-	 * @remarks The returned Array excludes that specify ViewAlignmentInternal.
+	 * @remarks The returned Array contains those subviews for which View::isVisibleSubview is true.
 	 * @memberof View
 	 */
 	Array *(*visibleSubviews)(const View *self);
@@ -721,3 +914,19 @@ OBJECTIVELYMVC_EXPORT void MVC_MakeFirstResponder(SDL_Window *window, View *view
  * @return The first responder for the given window, or `NULL` if none.
  */
 OBJECTIVELYMVC_EXPORT View *MVC_FirstResponder(SDL_Window *window);
+
+/**
+ * @brief Invalidates the cached render frames of all Views.
+ * @remarks This is called automatically after layout, after event dispatch, and when the View
+ * hierarchy changes. Applications that move Views outside of those phases should call it before
+ * relying on View::renderFrame.
+ */
+OBJECTIVELYMVC_EXPORT void MVC_InvalidateRenderFrames(void);
+
+/**
+ * @brief Invalidates the cached measurements of all Views.
+ * @remarks Measurements are invalidated per View (and its ancestors) when it is resized, laid
+ * out, or marked via View::setNeedsLayout. Applications that change what a View measures to by
+ * other means (e.g. fonts or scale) should call this before the next layout pass.
+ */
+OBJECTIVELYMVC_EXPORT void MVC_InvalidateMeasurements(void);
@@ -21,8 +21,11 @@
  * 3. This notice may not be removed or altered from any source distribution.
  */
 
+#include <ObjectivelyMVC/Config.h>
+
 #include <assert.h>
 
+#include <ObjectivelyMVC/Trace.h>
 #include <ObjectivelyMVC/ViewController.h>
 
 #define _Class _ViewController
@@ -81,16 +84,22 @@ static void addChildViewController(ViewController *self, ViewController *childVi
  */
 static void drawView(ViewController *self, Renderer *renderer) {
 
+	MVC_TraceBegin("drawView");
+
 	$(self, loadViewIfNeeded);
 
 	$(self->view, layoutIfNeeded);
 
+	MVC_InvalidateRenderFrames();
+
 	$(self->view, draw, renderer);
 
 	View *firstResponder = MVC_FirstResponder(self->view->window);
 	if (firstResponder) {
 		$(firstResponder, draw, renderer);
 	}
+
+	MVC_TraceEnd("drawView");
 }
 
 /**
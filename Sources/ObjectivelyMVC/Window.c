@@ -47,7 +47,9 @@ SDL_Rect MVC_TransformToWindow(SDL_Window *window, const SDL_Rect *rect) {
 double MVC_WindowScale(SDL_Window *window, int *height, int *drawableHeight) {
 
 	window = window ?: SDL_GL_GetCurrentWindow();
-	assert(window);
+	if (window == NULL) {
+		return 1.0;
+	}
 
 	int h;
 	SDL_GetWindowSize(window, NULL, &h);
@@ -38,7 +38,8 @@ OBJECTIVELYMVC_EXPORT SDL_Rect MVC_TransformToWindow(SDL_Window *window, const S
  * @param window The window, or `NULL` for the current OpenGL window.
  * @param height An optional output parameter to retrieve the window height.
  * @param drawableHeight AN optional output parameter to retrieve the window drawable height.
- * @return The scale factor of the specified window.
+ * @return The scale factor of the specified window, or `1.0` if `window` is `NULL` and no OpenGL
+ * window is current, as when rendering headless.
  * @remarks Views and other classes should invoke this method to alter their rendering behavior for
  * High-DPI displays. This is particularly relevant for Views that render textures.
  */
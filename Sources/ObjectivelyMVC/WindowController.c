@@ -21,13 +21,20 @@
  * 3. This notice may not be removed or altered from any source distribution.
  */
 
+#include <ObjectivelyMVC/Config.h>
+
 #include <assert.h>
 
 #include <Objectively/String.h>
 
+#include <ObjectivelyMVC/CoreRenderer.h>
+#include <ObjectivelyMVC/Image.h>
 #include <ObjectivelyMVC/Log.h>
+#include <ObjectivelyMVC/Trace.h>
 #include <ObjectivelyMVC/WindowController.h>
 
+#define MVC_WINDOW_CONTROLLER "windowController"
+
 #define _Class _WindowController
 
 #pragma mark - Object
@@ -39,7 +46,12 @@ static void dealloc(Object *self) {
 
 	WindowController *this = (WindowController *) self;
 
+	if (this->window && MVC_WindowController(this->window) == this) {
+		SDL_SetWindowData(this->window, MVC_WINDOW_CONTROLLER, NULL);
+	}
+
 	release(this->renderer);
+	release(this->rendererStatsView);
 	release(this->viewController);
 
 	super(Object, self, dealloc);
@@ -89,13 +101,65 @@ static WindowController *initWithWindow(WindowController *self, SDL_Window *wind
 		const Uint32 flags = SDL_GetWindowFlags(self->window);
 		assert(flags & SDL_WINDOW_OPENGL);
 
-		self->renderer = $(alloc(Renderer), init);
+		SDL_SetWindowData(self->window, MVC_WINDOW_CONTROLLER, self);
+
+		int profile = 0;
+		SDL_GL_GetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, &profile);
+
+		if (profile == SDL_GL_CONTEXT_PROFILE_CORE) {
+			self->renderer = (Renderer *) $(alloc(CoreRenderer), init);
+		} else {
+			self->renderer = $(alloc(Renderer), init);
+		}
 		assert(self->renderer);
+
+		$(self, setNeedsRenderInRect, NULL);
 	}
 
 	return self;
 }
 
+/**
+ * @return True if the given View or any of its descendants requires layout, false otherwise.
+ * @remarks Only branches marked via View::setNeedsLayout are searched.
+ */
+static _Bool needsLayout(const View *view) {
+
+	if (view->needsLayout || view->needsApplyConstraints) {
+		return true;
+	}
+
+	if (view->descendantsNeedLayout == false) {
+		return false;
+	}
+
+	const Array *subviews = (Array *) view->subviews;
+	for (size_t i = 0; i < subviews->count; i++) {
+		if (needsLayout($(subviews, objectAtIndex, i))) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @fn _Bool WindowController::needsRender(const WindowController *self)
+ * @memberof WindowController
+ */
+static _Bool needsRender(const WindowController *self) {
+
+	if (SDL_RectEmpty(&self->damage) == false) {
+		return true;
+	}
+
+	if (self->viewController && self->viewController->view) {
+		return needsLayout(self->viewController->view);
+	}
+
+	return false;
+}
+
 /**
  * @fn void WindowController::render(WindowController *self)
  * @memberof WindowController
@@ -104,6 +168,15 @@ static void render(WindowController *self) {
 
 	assert(self->renderer);
 
+	MVC_TraceBegin("render");
+
+	if (self->viewController) {
+		$(self->viewController, loadViewIfNeeded);
+		$(self->viewController->view, layoutIfNeeded);
+	}
+
+	$(self->renderer, setDamage, &self->damage);
+
 	$(self->renderer, beginFrame);
 
 	if (self->viewController) {
@@ -113,6 +186,16 @@ static void render(WindowController *self) {
 	}
 
 	$(self->renderer, endFrame);
+
+	const SDL_Rect damage = self->damage;
+
+	self->damage = MakeRect(0, 0, 0, 0);
+
+	if (self->rendererStatsView) {
+		$(self->rendererStatsView, updateStats, &self->renderer->stats, &damage);
+	}
+
+	MVC_TraceEnd("render");
 }
 
 /**
@@ -121,6 +204,8 @@ static void render(WindowController *self) {
  */
 static void respondToEvent(WindowController *self, const SDL_Event *event) {
 
+	MVC_TraceBegin("respondToEvent");
+
 	if (event->type == SDL_WINDOWEVENT) {
 
 		SDL_Window *window = SDL_GL_GetCurrentWindow();
@@ -129,6 +214,8 @@ static void respondToEvent(WindowController *self, const SDL_Event *event) {
 		if (window != self->window) {
 			self->window = window;
 
+			SDL_SetWindowData(self->window, MVC_WINDOW_CONTROLLER, self);
+
 			int w, h;
 			SDL_GetWindowSize(self->window, &w, &h);
 			MVC_LogInfo("Detected new window (%dx%d)", w, h);
@@ -142,6 +229,19 @@ static void respondToEvent(WindowController *self, const SDL_Event *event) {
 				$(self->viewController, renderDeviceDidReset);
 			}
 		}
+
+		switch (event->window.event) {
+			case SDL_WINDOWEVENT_SHOWN:
+			case SDL_WINDOWEVENT_EXPOSED:
+			case SDL_WINDOWEVENT_RESIZED:
+			case SDL_WINDOWEVENT_SIZE_CHANGED:
+			case SDL_WINDOWEVENT_MAXIMIZED:
+			case SDL_WINDOWEVENT_RESTORED:
+				$(self, setNeedsRenderInRect, NULL);
+				break;
+			default:
+				break;
+		}
 	} else if (event->type == MVC_NOTIFICATION_EVENT) {
 
 		if (self->viewController) {
@@ -151,6 +251,8 @@ static void respondToEvent(WindowController *self, const SDL_Event *event) {
 				.data = event->user.data2
 			});
 		}
+
+		$(self, setNeedsRenderInRect, NULL);
 	} else {
 		View *firstResponder = $(self, firstResponder, event);
 		if (firstResponder) {
@@ -169,6 +271,33 @@ static void respondToEvent(WindowController *self, const SDL_Event *event) {
 			MVC_LogDebug("firstResponder for event type %d is NULL\n", event->type);
 		}
 	}
+
+	MVC_InvalidateRenderFrames();
+
+	MVC_TraceEnd("respondToEvent");
+}
+
+/**
+ * @fn void WindowController::setNeedsRenderInRect(WindowController *self, const SDL_Rect *rect)
+ * @memberof WindowController
+ */
+static void setNeedsRenderInRect(WindowController *self, const SDL_Rect *rect) {
+
+	SDL_Rect window = MakeRect(0, 0, 0, 0);
+	SDL_GetWindowSize(self->window, &window.w, &window.h);
+
+	if (rect) {
+		SDL_Rect damage;
+		if (SDL_IntersectRect(rect, &window, &damage)) {
+			if (SDL_RectEmpty(&self->damage)) {
+				self->damage = damage;
+			} else {
+				SDL_UnionRect(&self->damage, &damage, &self->damage);
+			}
+		}
+	} else {
+		self->damage = window;
+	}
 }
 
 /**
@@ -179,6 +308,14 @@ static void setRenderer(WindowController *self, Renderer *renderer) {
 
 	if (self->renderer != renderer) {
 
+		if (self->renderer) {
+			$$(Image, resetTextures, self->renderer);
+
+			if (self->viewController) {
+				$(self->viewController, renderDeviceDidReset);
+			}
+		}
+
 		release(self->renderer);
 
 		if (renderer) {
@@ -186,6 +323,26 @@ static void setRenderer(WindowController *self, Renderer *renderer) {
 		} else {
 			self->renderer = NULL;
 		}
+
+		$(self, setNeedsRenderInRect, NULL);
+	}
+}
+
+/**
+ * @fn void WindowController::setRendererStatsView(WindowController *self, RendererStatsView *rendererStatsView)
+ * @memberof WindowController
+ */
+static void setRendererStatsView(WindowController *self, RendererStatsView *rendererStatsView) {
+
+	if (self->rendererStatsView != rendererStatsView) {
+
+		release(self->rendererStatsView);
+
+		if (rendererStatsView) {
+			self->rendererStatsView = retain(rendererStatsView);
+		} else {
+			self->rendererStatsView = NULL;
+		}
 	}
 }
 
@@ -218,6 +375,8 @@ static void setViewController(WindowController *self, ViewController *viewContro
 			$(self->viewController->view, setWindow, self->window);
 			$(self->viewController, viewDidAppear);
 		}
+
+		$(self, setNeedsRenderInRect, NULL);
 	}
 }
 
@@ -232,9 +391,12 @@ static void initialize(Class *clazz) {
 
 	((WindowControllerInterface *) clazz->def->interface)->firstResponder = firstResponder;
 	((WindowControllerInterface *) clazz->def->interface)->initWithWindow = initWithWindow;
+	((WindowControllerInterface *) clazz->def->interface)->needsRender = needsRender;
 	((WindowControllerInterface *) clazz->def->interface)->render = render;
 	((WindowControllerInterface *) clazz->def->interface)->respondToEvent = respondToEvent;
+	((WindowControllerInterface *) clazz->def->interface)->setNeedsRenderInRect = setNeedsRenderInRect;
 	((WindowControllerInterface *) clazz->def->interface)->setRenderer = setRenderer;
+	((WindowControllerInterface *) clazz->def->interface)->setRendererStatsView = setRendererStatsView;
 	((WindowControllerInterface *) clazz->def->interface)->setViewController = setViewController;
 }
 
@@ -259,3 +421,12 @@ Class *_WindowController(void) {
 }
 
 #undef _Class
+
+WindowController *MVC_WindowController(SDL_Window *window) {
+
+	if (window) {
+		return SDL_GetWindowData(window, MVC_WINDOW_CONTROLLER);
+	}
+
+	return NULL;
+}
@@ -25,6 +25,7 @@
 
 #include <Objectively/Object.h>
 
+#include <ObjectivelyMVC/RendererStatsView.h>
 #include <ObjectivelyMVC/ViewController.h>
 
 /**
@@ -53,11 +54,25 @@ struct WindowController {
 	 */
 	WindowControllerInterface *interface;
 
+	/**
+	 * @brief The region of the window, in object space, that must be rendered on the next frame.
+	 * @remarks Views contribute to this region via View::setNeedsDisplay. It is cleared after
+	 * each call to WindowController::render.
+	 * @private
+	 */
+	SDL_Rect damage;
+
 	/**
 	 * @brief The Renderer.
 	 */
 	Renderer *renderer;
 
+	/**
+	 * @brief An optional RendererStatsView, refreshed after each frame.
+	 * @see WindowController::setRendererStatsView
+	 */
+	RendererStatsView *rendererStatsView;
+
 	/**
 	 * @brief The ViewController.
 	 */
@@ -94,19 +109,51 @@ struct WindowControllerInterface {
 	 * @param self The WindowController.
 	 * @param window The window.
 	 * @return The initialized WindowController, or `NULL` on error.
+	 * @remarks A CoreRenderer is created if the window's OpenGL context uses the core profile.
+	 * Otherwise, a Renderer is created. Use WindowController::setRenderer to override this choice.
 	 * @memberof WindowController
 	 */
 	WindowController *(*initWithWindow)(WindowController *self, SDL_Window *window);
 
+	/**
+	 * @fn _Bool WindowController::needsRender(const WindowController *self)
+	 * @param self The WindowController.
+	 * @return True if any View has changed since the last frame was rendered, false otherwise.
+	 * @remarks Applications that render on demand may skip WindowController::render, and
+	 * swapping the window, for frames in which this method returns false.
+	 * @memberof WindowController
+	 */
+	_Bool (*needsRender)(const WindowController *self);
+
+	/**
+	 * @fn void WindowController::setNeedsRenderInRect(WindowController *self, const SDL_Rect *rect)
+	 * @brief Adds the given rectangle to the region that must be rendered on the next frame.
+	 * @param self The WindowController.
+	 * @param rect The rectangle, in object space, or `NULL` for the entire window.
+	 * @memberof WindowController
+	 */
+	void (*setNeedsRenderInRect)(WindowController *self, const SDL_Rect *rect);
+
 	/**
 	 * @fn void WindowController::setRenderer(WindowController *self, Renderer *renderer)
 	 * @brief Sets this WindowController's Renderer.
 	 * @param self The WindowController.
 	 * @param renderer The Renderer.
+	 * @remarks Image textures and View layers created by the previous Renderer are discarded.
 	 * @memberof WindowController
 	 */
 	void (*setRenderer)(WindowController *self, Renderer *renderer);
 
+	/**
+	 * @fn void WindowController::setRendererStatsView(WindowController *self, RendererStatsView *rendererStatsView)
+	 * @brief Sets the RendererStatsView to refresh after each frame.
+	 * @param self The WindowController.
+	 * @param rendererStatsView The RendererStatsView, or `NULL`.
+	 * @remarks The RendererStatsView must still be added to the View hierarchy to be drawn.
+	 * @memberof WindowController
+	 */
+	void (*setRendererStatsView)(WindowController *self, RendererStatsView *rendererStatsView);
+
 	/**
 	 * @fn void WindowController::setViewController(WindowController *self, ViewController *viewController)
 	 * @brief Sets this WindowController's ViewController.
@@ -121,6 +168,9 @@ struct WindowControllerInterface {
 	 * @brief Renders the ViewController's View.
 	 * @param self The WindowController.
 	 * @remarks Your application should call this method once per frame to render the View hierarchy.
+	 * @remarks The damaged region is passed to the Renderer, so that when Renderer::partialRedraw
+	 * is set, only Views intersecting it are redrawn.
+	 * @remarks The WindowController::rendererStatsView, if any, is updated after Renderer::endFrame.
 	 * @memberof WindowController
 	 */
 	void (*render)(WindowController *self);
@@ -153,3 +203,9 @@ struct WindowControllerInterface {
  * @memberof WindowController
  */
 OBJECTIVELYMVC_EXPORT Class *_WindowController(void);
+
+/**
+ * @param window The window.
+ * @return The WindowController managing the given window, or `NULL`.
+ */
+OBJECTIVELYMVC_EXPORT WindowController *MVC_WindowController(SDL_Window *window);
@@ -0,0 +1,540 @@
+/*
+ * ObjectivelyMVC: MVC framework for OpenGL and SDL2 in c.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <ObjectivelyMVC.h>
+
+/**
+ * @file
+ * @brief Headless benchmarks for layout, drawing, hit-testing, JSON inflation and TableView
+ * reloading, rendered with a SoftwareRenderer. Run with `make bench`, optionally passing
+ * `BENCH_SCALE=n` to multiply the size of each view tree by `n`.
+ * @details Each benchmark is repeated for at least BENCHMARK_MIN_ITERATIONS iterations and
+ * BENCHMARK_MIN_SECONDS, and reports the mean time per operation in nanoseconds.
+ */
+
+#define BENCHMARK_MIN_ITERATIONS 3
+#define BENCHMARK_MIN_SECONDS 0.5
+
+#define BENCHMARK_WIDTH 1024
+#define BENCHMARK_HEIGHT 768
+
+#define BENCHMARK_VIEWS 10000
+#define BENCHMARK_DEPTH 500
+#define BENCHMARK_ROWS 10000
+#define BENCHMARK_NESTING 10
+#define BENCHMARK_CONSTRAINTS 200
+
+#define BENCHMARK_JSON "Benchmark.json"
+#define BENCHMARK_COMPILED "Benchmark.mvcv"
+
+typedef void (*Operation)(View *view);
+
+static SDL_Window *window;
+static Renderer *renderer;
+static SDL_Point point;
+
+/**
+ * @brief Runs the given operation repeatedly, and reports its mean time in nanoseconds.
+ * @param name The benchmark name.
+ * @param view The View tree to operate on.
+ * @param count The count of Views in the tree.
+ * @param setup An optional untimed Operation to run before each iteration.
+ * @param operation The timed Operation.
+ */
+static void benchmark(const char *name, View *view, size_t count, Operation setup, Operation operation) {
+
+	const Uint64 frequency = SDL_GetPerformanceFrequency();
+	const Uint64 budget = frequency * BENCHMARK_MIN_SECONDS;
+
+	Uint64 elapsed = 0;
+	size_t iterations = 0;
+
+	while (iterations < BENCHMARK_MIN_ITERATIONS || elapsed < budget) {
+
+		if (setup) {
+			setup(view);
+		}
+
+		const Uint64 start = SDL_GetPerformanceCounter();
+		operation(view);
+		elapsed += SDL_GetPerformanceCounter() - start;
+
+		iterations++;
+	}
+
+	const double ns = elapsed * 1000000000.0 / frequency / iterations;
+
+	printf("%-32s %10zu views %8zu iterations %16.0f ns/op\n", name, count, iterations, ns);
+	fflush(stdout);
+}
+
+#pragma mark - Operations
+
+/**
+ * @brief Invalidates the layout of the given View and all of its descendants.
+ */
+static void invalidateLayout(View *view) {
+
+	$(view, setNeedsLayout);
+
+	const Array *subviews = (Array *) view->subviews;
+	for (size_t i = 0; i < subviews->count; i++) {
+		invalidateLayout($(subviews, objectAtIndex, i));
+	}
+}
+
+static void layoutIfNeeded(View *view) {
+	$(view, layoutIfNeeded);
+}
+
+static void draw(View *view) {
+
+	$(renderer, beginFrame);
+	$(view, draw, renderer);
+	$(renderer, endFrame);
+}
+
+static void hitTest(View *view) {
+
+	const View *hit = $(view, hitTest, &point);
+	assert(hit);
+}
+
+/**
+ * @brief Alternates the width of the given View, and lays it out.
+ */
+static void resize(View *view) {
+
+	const int w = view->frame.w == BENCHMARK_WIDTH ? BENCHMARK_WIDTH / 2 : BENCHMARK_WIDTH;
+
+	$(view, resize, &MakeSize(w, view->frame.h));
+	$(view, layoutIfNeeded);
+}
+
+static void reloadData(View *view) {
+	$((TableView *) view, reloadData);
+}
+
+static void viewWithContentsOfFile(View *view) {
+
+	View *inflated = $$(View, viewWithContentsOfFile, BENCHMARK_JSON, NULL);
+	assert(inflated);
+
+	release(inflated);
+}
+
+static void viewWithContentsOfCompiledFile(View *view) {
+
+	View *inflated = $$(View, viewWithContentsOfFile, BENCHMARK_COMPILED, NULL);
+	assert(inflated);
+
+	release(inflated);
+}
+
+static void readViewDescription(View *view) {
+
+	ident obj = MVC_ReadViewDescription(BENCHMARK_JSON);
+	assert(obj);
+
+	release(obj);
+}
+
+static void readCompiledViewDescription(View *view) {
+
+	ident obj = MVC_ReadViewDescription(BENCHMARK_COMPILED);
+	assert(obj);
+
+	release(obj);
+}
+
+#pragma mark - View trees
+
+/**
+ * @brief Attaches the given root View to the window and lays it out.
+ */
+static View *attach(View *view) {
+
+	$(view, setWindow, window);
+	$(view, layoutIfNeeded);
+
+	return view;
+}
+
+/**
+ * @return A window-sized View with `count` small subviews, tiled in rows.
+ */
+static View *createGrid(size_t count) {
+
+	View *view = $(alloc(View), initWithFrame, &MakeRect(0, 0, BENCHMARK_WIDTH, BENCHMARK_HEIGHT));
+
+	for (size_t i = 0; i < count; i++) {
+
+		const int columns = BENCHMARK_WIDTH / 8;
+		const SDL_Rect frame = MakeRect((i % columns) * 8, (int) (i / columns) * 8, 8, 8);
+
+		View *subview = $(alloc(View), initWithFrame, &frame);
+		subview->backgroundColor = MakeColor(i & 0xff, (i >> 8) & 0xff, 0x80, 0xff);
+
+		$(view, addSubview, subview);
+		release(subview);
+	}
+
+	return attach(view);
+}
+
+/**
+ * @return A chain of `depth` nested Views, each filling its superview.
+ */
+static View *createDeep(size_t depth) {
+
+	View *view = $(alloc(View), initWithFrame, &MakeRect(0, 0, BENCHMARK_WIDTH, BENCHMARK_HEIGHT));
+	View *superview = view;
+
+	for (size_t i = 1; i < depth; i++) {
+
+		View *subview = $(alloc(View), initWithFrame, NULL);
+		subview->autoresizingMask = ViewAutoresizingFill;
+		subview->backgroundColor = MakeColor(0x80, 0x80, 0x80, 0x10);
+
+		$(superview, addSubview, subview);
+		release(subview);
+
+		superview = subview;
+	}
+
+	return attach(view);
+}
+
+/**
+ * @return A vertical StackView of `count` thin Views.
+ */
+static View *createStack(size_t count) {
+
+	StackView *stackView = $(alloc(StackView), initWithFrame, &MakeRect(0, 0, BENCHMARK_WIDTH, BENCHMARK_HEIGHT));
+	stackView->spacing = 1;
+
+	for (size_t i = 0; i < count; i++) {
+
+		View *subview = $(alloc(View), initWithFrame, &MakeRect(0, 0, BENCHMARK_WIDTH, 2));
+		subview->backgroundColor = Colors.White;
+
+		$((View *) stackView, addSubview, subview);
+		release(subview);
+	}
+
+	return attach((View *) stackView);
+}
+
+/**
+ * @return A binary tree of `depth` levels of StackViews that contain their subviews.
+ */
+static View *createNestedStackView(size_t depth) {
+
+	if (depth == 0) {
+		View *view = $(alloc(View), initWithFrame, &MakeRect(0, 0, 8, 8));
+		view->backgroundColor = Colors.White;
+		return view;
+	}
+
+	StackView *stackView = $(alloc(StackView), initWithFrame, NULL);
+	stackView->axis = depth & 1 ? StackViewAxisHorizontal : StackViewAxisVertical;
+	stackView->spacing = 1;
+
+	for (size_t i = 0; i < 2; i++) {
+
+		View *subview = createNestedStackView(depth - 1);
+
+		$((View *) stackView, addSubview, subview);
+		release(subview);
+	}
+
+	return (View *) stackView;
+}
+
+/**
+ * @return A StackView nesting `depth` levels of StackViews, with `2 ^ depth` leaf Views.
+ */
+static View *createNested(size_t depth) {
+	return attach(createNestedStackView(depth));
+}
+
+/**
+ * @brief Writes an alphabetic View identifier for `index`, as Constraint descriptors require.
+ */
+static void identifierForIndex(size_t index, char *identifier, size_t size) {
+
+	size_t length = 0;
+	do {
+		assert(length + 1 < size);
+		identifier[length++] = 'a' + index % 26;
+		index /= 26;
+	} while (index);
+
+	identifier[length] = '\0';
+}
+
+/**
+ * @return A window-sized View with `count` subviews, each sized and stacked by Constraints.
+ */
+static View *createConstrained(size_t count) {
+
+	View *view = $(alloc(View), initWithFrame, &MakeRect(0, 0, BENCHMARK_WIDTH, BENCHMARK_HEIGHT));
+
+	char descriptor[64], identifier[16];
+
+	for (size_t i = 0; i < count; i++) {
+
+		View *subview = $(alloc(View), initWithFrame, &MakeRect(0, 0, 0, 2));
+		subview->backgroundColor = Colors.White;
+
+		identifierForIndex(i, identifier, sizeof(identifier));
+
+		subview->identifier = strdup(identifier);
+
+		snprintf(descriptor, sizeof(descriptor), "w = superview.w * 0.5 - %zu", i % 100 + 1);
+		$(subview, addConstraintWithDescriptor, descriptor);
+
+		if (i) {
+			identifierForIndex(i - 1, identifier, sizeof(identifier));
+
+			snprintf(descriptor, sizeof(descriptor), "t = %s.b + 1", identifier);
+			$(subview, addConstraintWithDescriptor, descriptor);
+		}
+
+		$(view, addSubview, subview);
+		release(subview);
+	}
+
+	return attach(view);
+}
+
+/**
+ * @see TableViewDataSource::numberOfRows
+ */
+static size_t numberOfRows(const TableView *tableView) {
+	return (size_t) (intptr_t) tableView->dataSource.self;
+}
+
+/**
+ * @see TableViewDataSource::valueForColumnAndRow
+ */
+static ident valueForColumnAndRow(const TableView *tableView, const TableColumn *column, size_t row) {
+	return (ident) (intptr_t) row;
+}
+
+/**
+ * @see TableViewDelegate::cellForColumnAndRow
+ */
+static TableCellView *cellForColumnAndRow(const TableView *tableView, const TableColumn *column, size_t row) {
+
+	TableCellView *cell = $((TableView *) tableView, dequeueReusableCell, column);
+	if (cell == NULL) {
+		cell = $(alloc(TableCellView), initWithFrame, NULL);
+	}
+
+	char text[32];
+	snprintf(text, sizeof(text), "%s %zu", column->identifier, row);
+
+	$(cell->text, setText, text);
+	return cell;
+}
+
+/**
+ * @return A virtualized TableView of `rows` rows and three columns.
+ */
+static View *createTable(size_t rows) {
+
+	TableView *tableView = $(alloc(TableView), initWithFrame, &MakeRect(0, 0, BENCHMARK_WIDTH, BENCHMARK_HEIGHT), ControlStyleDefault);
+	tableView->virtualized = true;
+
+	tableView->dataSource.self = (ident) (intptr_t) rows;
+	tableView->dataSource.numberOfRows = numberOfRows;
+	tableView->dataSource.valueForColumnAndRow = valueForColumnAndRow;
+	tableView->delegate.cellForColumnAndRow = cellForColumnAndRow;
+
+	const char *identifiers[] = { "A", "B", "C" };
+	for (size_t i = 0; i < lengthof(identifiers); i++) {
+
+		TableColumn *column = $(alloc(TableColumn), initWithIdentifier, identifiers[i]);
+		$(tableView, addColumn, column);
+		release(column);
+	}
+
+	$(tableView, reloadData);
+
+	return attach((View *) tableView);
+}
+
+/**
+ * @brief Writes a JSON view definition of `count` Views and Labels to BENCHMARK_JSON.
+ */
+static void writeJSON(size_t count) {
+
+	FILE *file = fopen(BENCHMARK_JSON, "w");
+	assert(file);
+
+	fprintf(file, "{\"class\":\"StackView\",\"spacing\":1,\"subviews\":[\n");
+
+	for (size_t i = 0; i < count; i++) {
+
+		const char *delimiter = i + 1 < count ? "," : "";
+
+		if (i % 10 == 0) {
+			fprintf(file, "{\"class\":\"Label\",\"text\":{\"text\":\"Label %zu\"}}%s\n", i, delimiter);
+		} else {
+			fprintf(file, "{\"class\":\"View\",\"frame\":[0,0,%zu,2]}%s\n", i % BENCHMARK_WIDTH, delimiter);
+		}
+	}
+
+	fprintf(file, "]}\n");
+	fclose(file);
+}
+
+/**
+ * @brief Compiles BENCHMARK_JSON to BENCHMARK_COMPILED.
+ */
+static void writeCompiled(void) {
+
+	Data *data = $$(Data, dataWithContentsOfFile, BENCHMARK_JSON);
+	assert(data);
+
+	ident obj = $$(JSONSerialization, objectFromData, data, 0);
+	assert(obj);
+
+	Data *compiled = MVC_CompileViewDescription(obj);
+	assert(compiled);
+
+	const _Bool written = $(compiled, writeToFile, BENCHMARK_COMPILED);
+	assert(written);
+
+	release(compiled);
+	release(obj);
+	release(data);
+}
+
+#pragma mark - Main
+
+/**
+ * @brief Program entry point.
+ * @details The optional argument is a scale factor for the size of each view tree.
+ */
+int main(int argc, char **argv) {
+
+	const size_t scale = argc > 1 ? strtoul(argv[1], NULL, 10) ?: 1 : 1;
+
+	SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+
+	if (SDL_Init(SDL_INIT_VIDEO)) {
+		fprintf(stderr, "SDL_Init: %s\n", SDL_GetError());
+		return 1;
+	}
+
+	window = SDL_CreateWindow(__FILE__, 0, 0, BENCHMARK_WIDTH, BENCHMARK_HEIGHT, SDL_WINDOW_HIDDEN);
+	if (window == NULL) {
+		fprintf(stderr, "SDL_CreateWindow: %s\n", SDL_GetError());
+		return 1;
+	}
+
+	renderer = (Renderer *) $(alloc(SoftwareRenderer), initWithSize, &MakeSize(BENCHMARK_WIDTH, BENCHMARK_HEIGHT));
+
+	View *view;
+
+	const size_t views = BENCHMARK_VIEWS * scale;
+
+	view = createGrid(views);
+	point = MakePoint(1, 1);
+	benchmark("grid/layoutIfNeeded", view, views, invalidateLayout, layoutIfNeeded);
+	benchmark("grid/layoutIfNeeded/clean", view, views, NULL, layoutIfNeeded);
+	benchmark("grid/draw", view, views, NULL, draw);
+	benchmark("grid/hitTest", view, views, NULL, hitTest);
+	release(view);
+
+	const size_t depth = BENCHMARK_DEPTH;
+
+	view = createDeep(depth);
+	point = MakePoint(BENCHMARK_WIDTH / 2, BENCHMARK_HEIGHT / 2);
+	benchmark("deep/layoutIfNeeded", view, depth, invalidateLayout, layoutIfNeeded);
+	benchmark("deep/layoutIfNeeded/clean", view, depth, NULL, layoutIfNeeded);
+	benchmark("deep/draw", view, depth, NULL, draw);
+	benchmark("deep/hitTest", view, depth, NULL, hitTest);
+	release(view);
+
+	view = createStack(views);
+	point = MakePoint(1, 1);
+	benchmark("stack/layoutIfNeeded", view, views, invalidateLayout, layoutIfNeeded);
+	benchmark("stack/layoutIfNeeded/clean", view, views, NULL, layoutIfNeeded);
+	benchmark("stack/draw", view, views, NULL, draw);
+	benchmark("stack/hitTest", view, views, NULL, hitTest);
+	release(view);
+
+	const size_t nesting = BENCHMARK_NESTING;
+
+	view = createNested(nesting);
+	point = MakePoint(1, 1);
+	benchmark("nested/layoutIfNeeded", view, (2 << nesting) - 1, invalidateLayout, layoutIfNeeded);
+	benchmark("nested/layoutIfNeeded/clean", view, (2 << nesting) - 1, NULL, layoutIfNeeded);
+	benchmark("nested/draw", view, (2 << nesting) - 1, NULL, draw);
+	release(view);
+
+	const size_t constraints = BENCHMARK_CONSTRAINTS * scale;
+
+	view = createConstrained(constraints);
+	point = MakePoint(1, 1);
+	benchmark("constraints/layoutIfNeeded", view, constraints, invalidateLayout, layoutIfNeeded);
+	benchmark("constraints/layoutIfNeeded/clean", view, constraints, NULL, layoutIfNeeded);
+	benchmark("constraints/resize", view, constraints, NULL, resize);
+	release(view);
+
+	const size_t rows = BENCHMARK_ROWS * scale;
+
+	view = createTable(rows);
+	point = MakePoint(BENCHMARK_WIDTH / 2, BENCHMARK_HEIGHT / 2);
+	benchmark("table/reloadData", view, rows, NULL, reloadData);
+	benchmark("table/layoutIfNeeded", view, rows, invalidateLayout, layoutIfNeeded);
+	benchmark("table/layoutIfNeeded/clean", view, rows, NULL, layoutIfNeeded);
+	benchmark("table/draw", view, rows, NULL, draw);
+	benchmark("table/hitTest", view, rows, NULL, hitTest);
+	release(view);
+
+	writeJSON(views);
+	benchmark("json/readViewDescription", NULL, views, NULL, readViewDescription);
+	benchmark("json/viewWithContentsOfFile", NULL, views, NULL, viewWithContentsOfFile);
+	writeCompiled();
+	benchmark("compiled/readViewDescription", NULL, views, NULL, readCompiledViewDescription);
+	benchmark("compiled/viewWithContentsOfFile", NULL, views, NULL, viewWithContentsOfCompiledFile);
+	remove(BENCHMARK_COMPILED);
+	remove(BENCHMARK_JSON);
+
+	release(renderer);
+
+	SDL_DestroyWindow(window);
+	SDL_Quit();
+
+	return 0;
+}
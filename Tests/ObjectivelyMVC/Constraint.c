@@ -100,6 +100,25 @@ START_TEST(constraint)
 
 	release(constraint);
 
+	constraint = $(alloc(Constraint), initWithDescriptor, "t = foo.b + 10");
+	ck_assert(constraint != NULL);
+
+	Constraint *other = $(alloc(Constraint), initWithDescriptor, "t = foo.b + 10");
+	ck_assert(other != NULL);
+
+	ck_assert_ptr_eq(constraint->descriptor, other->descriptor);
+	ck_assert_ptr_eq(constraint->identifier, other->identifier);
+	ck_assert_int_eq(ConstraintAttributeTop, other->target);
+	ck_assert_int_eq(ConstraintAttributeBottom, other->source);
+	ck_assert_int_eq(10, other->constant);
+
+	release(constraint);
+	release(other);
+
+	ck_assert(NULL == $(alloc(Constraint), initWithDescriptor, "w"));
+	ck_assert(NULL == $(alloc(Constraint), initWithDescriptor, "w = foo"));
+	ck_assert(NULL == $(alloc(Constraint), initWithDescriptor, "w = h + 10 [20"));
+
 }END_TEST
 
 int main(int argc, char **argv) {
@@ -0,0 +1,116 @@
+/*
+ * ObjectivelyMVC: MVC framework for OpenGL and SDL2 in c.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <unistd.h>
+#include <check.h>
+
+#include <ObjectivelyMVC.h>
+
+#define TERM(v, c) (SolverTerm) { .variable = v, .coefficient = c }
+
+START_TEST(constraintSolver)
+{
+	ConstraintSolver *solver = $(alloc(ConstraintSolver), init);
+	ck_assert(solver != NULL);
+	ck_assert_ptr_eq(_ConstraintSolver(), classof(solver));
+
+	const SolverVariable superview = $(solver, createVariable);
+	const SolverVariable width = $(solver, createVariable);
+
+	$(solver, addEditVariable, superview, SOLVER_STRENGTH_STRONG);
+	$(solver, addEditVariable, width, SOLVER_STRENGTH_WEAK);
+
+	$(solver, suggestValue, superview, 300);
+	$(solver, suggestValue, width, 100);
+
+	ck_assert_int_eq(300, $(solver, valueOfVariable, superview));
+	ck_assert_int_eq(100, $(solver, valueOfVariable, width));
+
+	const SolverTerm equal[] = { TERM(width, 1), TERM(superview, -1) };
+	const SolverConstraint c1 = $(solver, addConstraint, equal, 2, 20, ConstraintRelationEqual, SOLVER_STRENGTH_MEDIUM);
+	ck_assert(c1 != 0);
+
+	ck_assert_int_eq(300, $(solver, valueOfVariable, superview));
+	ck_assert_int_eq(280, $(solver, valueOfVariable, width));
+
+	const SolverTerm minimum[] = { TERM(width, 1) };
+	const SolverConstraint c2 = $(solver, addConstraint, minimum, 1, -500, ConstraintRelationGreaterThanOrEqual, SOLVER_STRENGTH_MEDIUM * 2);
+	ck_assert(c2 != 0);
+
+	ck_assert_int_eq(500, $(solver, valueOfVariable, width));
+
+	$(solver, suggestValue, superview, 1000);
+
+	ck_assert_int_eq(1000, $(solver, valueOfVariable, superview));
+	ck_assert_int_eq(980, $(solver, valueOfVariable, width));
+
+	$(solver, removeConstraint, c2);
+	$(solver, suggestValue, superview, 200);
+
+	ck_assert_int_eq(180, $(solver, valueOfVariable, width));
+
+	$(solver, removeConstraint, c1);
+	$(solver, suggestValue, width, 50);
+
+	ck_assert_int_eq(200, $(solver, valueOfVariable, superview));
+	ck_assert_int_eq(50, $(solver, valueOfVariable, width));
+
+	const SolverVariable a = $(solver, createVariable);
+	const SolverVariable b = $(solver, createVariable);
+
+	const SolverTerm sum[] = { TERM(a, 1), TERM(b, 1) };
+	ck_assert_int_eq(c1, $(solver, addConstraint, sum, 2, -10, ConstraintRelationEqual, SOLVER_STRENGTH_REQUIRED));
+
+	const SolverTerm difference[] = { TERM(a, 1), TERM(b, -1) };
+	ck_assert($(solver, addConstraint, difference, 2, -2, ConstraintRelationEqual, SOLVER_STRENGTH_REQUIRED) != 0);
+
+	ck_assert_int_eq(6, $(solver, valueOfVariable, a));
+	ck_assert_int_eq(4, $(solver, valueOfVariable, b));
+
+	const SolverTerm conflict[] = { TERM(a, 1) };
+	ck_assert_int_eq(0, $(solver, addConstraint, conflict, 1, -1, ConstraintRelationEqual, SOLVER_STRENGTH_REQUIRED));
+
+	$(solver, removeVariable, width);
+	ck_assert_int_eq(width, $(solver, createVariable));
+
+	release(solver);
+
+}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("constraintSolver");
+	tcase_add_test(tcase, constraintSolver);
+
+	Suite *suite = suite_create("constraintSolver");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
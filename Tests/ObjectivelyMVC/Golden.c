@@ -0,0 +1,373 @@
+/*
+ * ObjectivelyMVC: MVC framework for OpenGL and SDL2 in c.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <check.h>
+
+#include <SDL2/SDL_image.h>
+
+#include <ObjectivelyMVC.h>
+
+/**
+ * @file
+ * @brief Golden image tests, rendered headless with a SoftwareRenderer.
+ * @details Each test renders a fixture and compares it to `GOLDEN/<name>.png`. A missing golden
+ * image is a failure. Set `GOLDEN_UPDATE` in the environment to record golden images instead of
+ * comparing them. Mismatched renders are written to `<name>.actual.png` in the working directory
+ * for inspection, so that the source tree is never written to by `make check`.
+ * @remarks Fixtures draw text with the font in `GOLDEN/Fonts` and images from `GOLDEN`, so that
+ * they do not depend on the installed fonts or resources. Tests whose golden images are not yet
+ * recorded are skipped.
+ */
+
+#define GOLDEN_WIDTH 1024
+#define GOLDEN_HEIGHT 768
+
+/**
+ * @brief The maximum per-channel difference of matching pixels.
+ */
+#define GOLDEN_CHANNEL_TOLERANCE 2
+
+/**
+ * @brief The maximum ratio of mismatched pixels.
+ */
+#define GOLDEN_PIXEL_TOLERANCE 0.001
+
+#define GOLDEN_FONT GOLDEN "/Fonts/Lato-Regular.ttf"
+
+static SDL_Window *window;
+static Renderer *renderer;
+
+/**
+ * @brief Sets the default Fonts for all categories to the golden font.
+ */
+static void setDefaultFonts(void) {
+
+	Data *data = $$(Data, dataWithContentsOfFile, GOLDEN_FONT);
+	ck_assert_msg(data != NULL, "%s: Failed to load golden font", GOLDEN_FONT);
+
+	for (FontCategory category = FontCategoryDefault; category < FontCategoryMax; category++) {
+
+		const int size = category == FontCategorySecondaryLabel || category == FontCategorySecondaryControl ? 14 : 16;
+
+		Font *font = $(alloc(Font), initWithData, data, size, 0);
+		ck_assert(font != NULL);
+
+		$$(Font, setDefaultFont, category, font);
+		release(font);
+	}
+
+	release(data);
+}
+
+static void setup(void) {
+
+	SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+
+	ck_assert_int_eq(0, SDL_Init(SDL_INIT_VIDEO));
+
+	window = SDL_CreateWindow(__FILE__, 0, 0, GOLDEN_WIDTH, GOLDEN_HEIGHT, SDL_WINDOW_HIDDEN);
+	ck_assert(window != NULL);
+
+	renderer = (Renderer *) $(alloc(SoftwareRenderer), initWithSize, &MakeSize(GOLDEN_WIDTH, GOLDEN_HEIGHT));
+	ck_assert(renderer != NULL);
+
+	$$(Resource, addResourcePath, GOLDEN);
+
+	setDefaultFonts();
+}
+
+static void teardown(void) {
+
+	for (FontCategory category = FontCategoryDefault; category < FontCategoryMax; category++) {
+		$$(Font, setDefaultFont, category, NULL);
+	}
+
+	$$(Resource, removeResourcePath, GOLDEN);
+
+	release(renderer);
+
+	SDL_DestroyWindow(window);
+	SDL_Quit();
+}
+
+/**
+ * @brief Compares the most recent frame to the golden image of the given name.
+ * @return True if the frame matches the golden image within tolerance, or was recorded.
+ */
+static _Bool compareGolden(const char *name) {
+
+	SDL_Surface *actual = ((SoftwareRenderer *) renderer)->surface;
+
+	char path[PATH_MAX];
+	snprintf(path, sizeof(path), "%s/%s.png", GOLDEN, name);
+
+	if (getenv("GOLDEN_UPDATE")) {
+		printf("Recording %s\n", path);
+		return IMG_SavePNG(actual, path) == 0;
+	}
+
+	if (access(path, R_OK) == -1) {
+		printf("%s: Missing golden image, set GOLDEN_UPDATE to record it\n", path);
+		return false;
+	}
+
+	SDL_Surface *image = IMG_Load(path);
+	ck_assert_msg(image != NULL, "%s: %s", path, IMG_GetError());
+
+	SDL_Surface *expected = SDL_ConvertSurface(image, actual->format, 0);
+	ck_assert(expected != NULL);
+
+	SDL_FreeSurface(image);
+
+	ck_assert_int_eq(expected->w, actual->w);
+	ck_assert_int_eq(expected->h, actual->h);
+
+	size_t mismatched = 0;
+
+	for (int y = 0; y < actual->h; y++) {
+
+		const Uint8 *a = (Uint8 *) actual->pixels + y * actual->pitch;
+		const Uint8 *e = (Uint8 *) expected->pixels + y * expected->pitch;
+
+		for (int x = 0; x < actual->w; x++, a += 4, e += 4) {
+			for (int i = 0; i < 4; i++) {
+				if (abs(a[i] - e[i]) > GOLDEN_CHANNEL_TOLERANCE) {
+					mismatched++;
+					break;
+				}
+			}
+		}
+	}
+
+	SDL_FreeSurface(expected);
+
+	const double ratio = mismatched / (double) (actual->w * actual->h);
+	if (ratio > GOLDEN_PIXEL_TOLERANCE) {
+
+		snprintf(path, sizeof(path), "%s.actual.png", name);
+		IMG_SavePNG(actual, path);
+
+		printf("%s: %zu pixels differ, see %s\n", name, mismatched, path);
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Renders a frame of the given View, within a window-sized root View.
+ */
+static void renderView(View *view) {
+
+	View *root = $(alloc(View), initWithFrame, &MakeRect(0, 0, GOLDEN_WIDTH, GOLDEN_HEIGHT));
+
+	$(root, addSubview, view);
+	$(root, setWindow, window);
+	$(root, layoutIfNeeded);
+
+	$(renderer, beginFrame);
+	$(root, draw, renderer);
+	$(renderer, endFrame);
+
+	$(view, removeFromSuperview);
+	release(root);
+}
+
+START_TEST(primitives)
+{
+	$(renderer, beginFrame);
+
+	$(renderer, setDrawColor, &MakeColor(255, 0, 0, 255));
+	$(renderer, drawRectFilled, &MakeRect(16, 16, 128, 96));
+
+	$(renderer, setDrawColor, &MakeColor(0, 0, 255, 128));
+	$(renderer, drawRectFilled, &MakeRect(80, 64, 128, 96));
+
+	$(renderer, setDrawColor, &MakeColor(255, 255, 255, 255));
+	$(renderer, drawRect, &MakeRect(240, 16, 128, 96));
+
+	const SDL_Point points[] = {
+		MakePoint(400, 112),
+		MakePoint(448, 16),
+		MakePoint(496, 112),
+		MakePoint(544, 16)
+	};
+
+	$(renderer, setDrawColor, &MakeColor(0, 255, 0, 255));
+	$(renderer, drawLines, points, lengthof(points));
+
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+	SDL_Surface *surface = SDL_CreateRGBSurface(0, 8, 8, 32, 0x000000ff, 0x0000ff00, 0x00ff0000, 0xff000000);
+#else
+	SDL_Surface *surface = SDL_CreateRGBSurface(0, 8, 8, 32, 0xff000000, 0x00ff0000, 0x0000ff00, 0x000000ff);
+#endif
+	ck_assert(surface != NULL);
+
+	for (int y = 0; y < surface->h; y++) {
+		Uint32 *pixel = (Uint32 *) ((Uint8 *) surface->pixels + y * surface->pitch);
+		for (int x = 0; x < surface->w; x++, pixel++) {
+			*pixel = (x + y) & 1 ? SDL_MapRGBA(surface->format, 255, 255, 255, 255) : SDL_MapRGBA(surface->format, 0, 0, 0, 128);
+		}
+	}
+
+	const GLuint texture = $(renderer, createTexture, surface);
+	ck_assert(texture != 0);
+
+	$(renderer, setDrawColor, &Colors.White);
+	$(renderer, drawTexture, texture, &MakeRect(16, 192, 64, 64));
+
+	$(renderer, setDrawColor, &MakeColor(255, 128, 0, 255));
+	$(renderer, drawTexture, texture, &MakeRect(96, 192, 128, 64));
+
+	$(renderer, setClippingFrame, &MakeRect(256, 192, 64, 64));
+	$(renderer, setDrawColor, &MakeColor(255, 255, 0, 255));
+	$(renderer, drawRectFilled, &MakeRect(224, 160, 128, 128));
+
+	$(renderer, endFrame);
+
+	ck_assert(compareGolden("primitives"));
+
+	$(renderer, deleteTexture, texture);
+	ck_assert_int_eq(texture, $(renderer, createTexture, surface));
+
+	*(Uint32 *) surface->pixels = SDL_MapRGBA(surface->format, 255, 0, 0, 255);
+	$(renderer, updateTexture, texture, surface, &MakeRect(0, 0, 1, 1));
+
+	const Uint8 *pixels = ((SoftwareRenderer *) renderer)->textures[texture - 1].pixels;
+	ck_assert(pixels[0] == 255 && pixels[1] == 0 && pixels[2] == 0 && pixels[3] == 255);
+	ck_assert(pixels[4] == 255 && pixels[7] == 255);
+
+	SDL_FreeSurface(surface);
+
+}END_TEST
+
+START_TEST(views)
+{
+	View *view = $$(View, viewWithContentsOfFile, GOLDEN "/Views.json", NULL);
+	ck_assert(view != NULL);
+
+	renderView(view);
+	release(view);
+
+	ck_assert(compareGolden("Views"));
+
+}END_TEST
+
+START_TEST(compiledViews)
+{
+	Data *data = $$(Data, dataWithContentsOfFile, GOLDEN "/Views.json");
+	ck_assert(data != NULL);
+
+	ident obj = $$(JSONSerialization, objectFromData, data, 0);
+	ck_assert(obj != NULL);
+
+	Data *compiled = MVC_CompileViewDescription(obj);
+	ck_assert(compiled != NULL);
+
+	View *view = $$(View, viewWithData, compiled, NULL);
+	ck_assert(view != NULL);
+
+	renderView(view);
+	release(view);
+
+	release(compiled);
+	release(obj);
+	release(data);
+
+	ck_assert(compareGolden("Views"));
+
+}END_TEST
+
+START_TEST(helloViewController)
+{
+	View *view = $$(View, viewWithContentsOfFile, EXAMPLES "/HelloViewController.json", NULL);
+	ck_assert(view != NULL);
+
+	renderView(view);
+	release(view);
+
+	ck_assert(compareGolden("HelloViewController"));
+
+}END_TEST
+
+START_TEST(controls)
+{
+	View *view = $$(View, viewWithContentsOfFile, GOLDEN "/Controls.json", NULL);
+	ck_assert(view != NULL);
+
+	renderView(view);
+	release(view);
+
+	ck_assert(compareGolden("Controls"));
+
+}END_TEST
+
+/**
+ * @return True if the golden image of the given name is recorded, or is being recorded.
+ */
+static _Bool isRecorded(const char *name) {
+
+	char path[PATH_MAX];
+	snprintf(path, sizeof(path), "%s/%s.png", GOLDEN, name);
+
+	if (getenv("GOLDEN_UPDATE") || access(path, R_OK) == 0) {
+		return true;
+	}
+
+	printf("Skipping %s, its golden image is not recorded\n", name);
+	return false;
+}
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("golden");
+	tcase_add_checked_fixture(tcase, setup, teardown);
+	tcase_add_test(tcase, primitives);
+	tcase_add_test(tcase, views);
+	tcase_add_test(tcase, compiledViews);
+
+	if (isRecorded("HelloViewController")) {
+		tcase_add_test(tcase, helloViewController);
+	}
+
+	if (isRecorded("Controls")) {
+		tcase_add_test(tcase, controls);
+	}
+
+	Suite *suite = suite_create("golden");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
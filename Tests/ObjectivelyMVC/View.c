@@ -0,0 +1,357 @@
+/*
+ * ObjectivelyMVC: MVC framework for OpenGL and SDL2 in c.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <unistd.h>
+#include <check.h>
+
+#include <ObjectivelyMVC.h>
+
+/**
+ * @return A new View with the given frame, identifier and Constraint descriptors, added to `superview`.
+ */
+static View *constrainedView(View *superview, const SDL_Rect *frame, const char *identifier, const char *descriptors[]) {
+
+	View *view = $(alloc(View), initWithFrame, frame);
+	ck_assert(view != NULL);
+
+	if (identifier) {
+		view->identifier = strdup(identifier);
+	}
+
+	for (const char **descriptor = descriptors; *descriptor; descriptor++) {
+		$(view, addConstraintWithDescriptor, *descriptor);
+	}
+
+	$(superview, addSubview, view);
+	release(view);
+
+	return view;
+}
+
+START_TEST(relations)
+{
+	View *root = $(alloc(View), initWithFrame, &MakeRect(0, 0, 400, 300));
+
+	View *a = constrainedView(root, &MakeRect(0, 0, 100, 10), NULL, (const char *[]) { "w >= 200", NULL });
+	View *b = constrainedView(root, &MakeRect(0, 0, 300, 10), NULL, (const char *[]) { "w <= 150", NULL });
+	View *c = constrainedView(root, &MakeRect(0, 0, 120, 10), NULL, (const char *[]) { "w >= 100", "w <= 150", NULL });
+	View *d = constrainedView(root, &MakeRect(0, 0, 100, 10), NULL, (const char *[]) { "w > superview.w * 0.5", "h < w", NULL });
+
+	$(root, layoutIfNeeded);
+
+	ck_assert_int_eq(200, a->frame.w);
+	ck_assert_int_eq(150, b->frame.w);
+	ck_assert_int_eq(120, c->frame.w);
+	ck_assert_int_eq(200, d->frame.w);
+	ck_assert_int_eq(10, d->frame.h);
+
+	$(root, resize, &MakeSize(600, 300));
+	$(root, layoutIfNeeded);
+
+	ck_assert_int_eq(200, a->frame.w);
+	ck_assert_int_eq(300, d->frame.w);
+
+	release(root);
+
+}END_TEST
+
+START_TEST(priorities)
+{
+	View *root = $(alloc(View), initWithFrame, &MakeRect(0, 0, 400, 300));
+
+	View *a = constrainedView(root, &MakeRect(0, 0, 100, 10), NULL, (const char *[]) { "w = 200 [50]", "w = 300 [200]", NULL });
+	View *b = constrainedView(root, &MakeRect(0, 0, 100, 10), NULL, (const char *[]) { "w = 300 [200]", "w = 200 [50]", NULL });
+	View *c = constrainedView(root, &MakeRect(0, 0, 100, 10), NULL, (const char *[]) { "w = 300", "w <= 250 [500]", NULL });
+	View *d = constrainedView(root, &MakeRect(0, 0, 100, 10), NULL, (const char *[]) { "w = superview.w [50]", "w <= 120", NULL });
+
+	$(root, layoutIfNeeded);
+
+	ck_assert_int_eq(300, a->frame.w);
+	ck_assert_int_eq(300, b->frame.w);
+	ck_assert_int_eq(250, c->frame.w);
+	ck_assert_int_eq(120, d->frame.w);
+
+	release(root);
+
+}END_TEST
+
+START_TEST(dependencies)
+{
+	View *root = $(alloc(View), initWithFrame, &MakeRect(0, 0, 400, 300));
+
+	View *c = constrainedView(root, NULL, "c", (const char *[]) { "l = b.r + 5", "t = b.b", NULL });
+	View *b = constrainedView(root, NULL, "b", (const char *[]) { "l = a.r + 5", "w = a.w", "h = a.h * 2", NULL });
+	View *a = constrainedView(root, NULL, "a", (const char *[]) { "l = 10", "w = 40", "h = 20", NULL });
+
+	$(root, layoutIfNeeded);
+
+	ck_assert_int_eq(10, a->frame.x);
+	ck_assert_int_eq(55, b->frame.x);
+	ck_assert_int_eq(40, b->frame.w);
+	ck_assert_int_eq(40, b->frame.h);
+	ck_assert_int_eq(100, c->frame.x);
+	ck_assert_int_eq(40, c->frame.y);
+
+	ck_assert(root->needsLayout == false);
+	ck_assert(root->descendantsNeedLayout == false);
+
+	$(a, addConstraintWithDescriptor, "w = 60 [200]");
+	$(root, layoutIfNeeded);
+
+	ck_assert_int_eq(60, b->frame.w);
+	ck_assert_int_eq(140, c->frame.x);
+
+	release(root);
+
+}END_TEST
+
+START_TEST(resize)
+{
+	View *root = $(alloc(View), initWithFrame, &MakeRect(0, 0, 400, 300));
+
+	View *a = constrainedView(root, NULL, "a", (const char *[]) { "w = superview.w * 0.5", "h = superview.h - 20", NULL });
+	View *b = constrainedView(root, NULL, "b", (const char *[]) { "l = a.r", "w = 50", NULL });
+	View *c = constrainedView(root, &MakeRect(5, 5, 70, 70), NULL, (const char *[]) { "w = 70", NULL });
+
+	$(root, layoutIfNeeded);
+
+	ck_assert_int_eq(200, a->frame.w);
+	ck_assert_int_eq(280, a->frame.h);
+	ck_assert_int_eq(200, b->frame.x);
+
+	for (int i = 0; i < 10; i++) {
+
+		$(root, resize, &MakeSize(600, 300));
+		$(root, layoutIfNeeded);
+
+		ck_assert_int_eq(300, a->frame.w);
+		ck_assert_int_eq(280, a->frame.h);
+		ck_assert_int_eq(300, b->frame.x);
+		ck_assert_int_eq(50, b->frame.w);
+
+		$(root, resize, &MakeSize(400, 200));
+		$(root, layoutIfNeeded);
+
+		ck_assert_int_eq(200, a->frame.w);
+		ck_assert_int_eq(180, a->frame.h);
+		ck_assert_int_eq(200, b->frame.x);
+	}
+
+	ck_assert_int_eq(5, c->frame.x);
+	ck_assert_int_eq(70, c->frame.w);
+	ck_assert_int_eq(70, c->frame.h);
+
+	release(root);
+
+}END_TEST
+
+START_TEST(removeSubview)
+{
+	View *root = $(alloc(View), initWithFrame, &MakeRect(0, 0, 400, 300));
+
+	View *a = constrainedView(root, NULL, "a", (const char *[]) { "w = 100", "h = 50", NULL });
+	View *b = constrainedView(root, NULL, "b", (const char *[]) { "l = a.r + 10", "w = a.w", NULL });
+	View *c = constrainedView(root, NULL, "c", (const char *[]) { "w = superview.w - 20", NULL });
+
+	$(root, layoutIfNeeded);
+
+	ck_assert_int_eq(100, a->frame.w);
+	ck_assert_int_eq(110, b->frame.x);
+	ck_assert_int_eq(100, b->frame.w);
+	ck_assert_int_eq(380, c->frame.w);
+
+	ConstraintSolver *solver = root->constraintSolver;
+	ck_assert(solver != NULL);
+
+	retain(a);
+
+	$(a, removeFromSuperview);
+
+	ck_assert_ptr_eq(solver, root->constraintSolver);
+	ck_assert(a->nextConstrainedView == NULL);
+	for (int i = 0; i < ViewFrameComponents; i++) {
+		ck_assert_int_eq(0, a->frameVariables[i].variable);
+	}
+
+	const Constraint *dangling = $((Array *) b->constraints, firstObject);
+	ck_assert_int_eq(0, dangling->solverConstraint);
+
+	$(root, resize, &MakeSize(600, 300));
+	$(root, layoutIfNeeded);
+
+	ck_assert_int_eq(580, c->frame.w);
+
+	View *d = constrainedView(root, NULL, "a", (const char *[]) { "l = 40", "w = 60", NULL });
+
+	$(root, layoutIfNeeded);
+
+	ck_assert_ptr_eq(solver, root->constraintSolver);
+	ck_assert_int_eq(110, b->frame.x);
+	ck_assert_int_eq(60, b->frame.w);
+
+	$(root, addSubview, a);
+	release(a);
+
+	$(d, removeFromSuperview);
+	$(root, layoutIfNeeded);
+
+	ck_assert_int_eq(100, a->frame.w);
+	ck_assert_int_eq(110, b->frame.x);
+	ck_assert_int_eq(100, b->frame.w);
+
+	release(root);
+
+}END_TEST
+
+/**
+ * @brief View::visibleSubviews override that excludes all but the first subview.
+ */
+static Array *visibleSubviews_first(const View *self) {
+
+	View *subview = $((Array *) self->subviews, firstObject);
+
+	MutableArray *subviews = $$(MutableArray, array);
+	$(subviews, addObject, subview);
+
+	return (Array *) subviews;
+}
+
+/**
+ * @brief Initializes a View subclass that overrides View::visibleSubviews.
+ */
+static void initialize_first(Class *clazz) {
+	((ViewInterface *) clazz->def->interface)->visibleSubviews = visibleSubviews_first;
+}
+
+/**
+ * @return The View subclass that overrides View::visibleSubviews.
+ */
+static Class *_FirstSubviewView(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "FirstSubviewView";
+		clazz.superclass = _View();
+		clazz.instanceSize = sizeof(View);
+		clazz.interfaceOffset = offsetof(View, interface);
+		clazz.interfaceSize = sizeof(ViewInterface);
+		clazz.initialize = initialize_first;
+	});
+
+	return &clazz;
+}
+
+START_TEST(visibleSubviews)
+{
+	View *view = $(alloc(View), initWithFrame, NULL);
+	view->autoresizingMask = ViewAutoresizingContain;
+
+	View *first = $((View *) _alloc(_FirstSubviewView()), initWithFrame, NULL);
+	first->autoresizingMask = ViewAutoresizingContain;
+
+	for (int i = 0; i < 2; i++) {
+
+		const SDL_Rect frame = MakeRect(0, 0, 10 + 40 * i, 10 + 40 * i);
+
+		View *subview = $(alloc(View), initWithFrame, &frame);
+		$(view, addSubview, subview);
+		release(subview);
+
+		subview = $(alloc(View), initWithFrame, &frame);
+		$(first, addSubview, subview);
+		release(subview);
+	}
+
+	View *hidden = $(alloc(View), initWithFrame, &MakeRect(0, 0, 100, 100));
+	hidden->hidden = true;
+
+	$(view, addSubview, hidden);
+	release(hidden);
+
+	const SDL_Size size = $(view, sizeThatFits);
+	ck_assert_int_eq(50, size.w);
+	ck_assert_int_eq(50, size.h);
+
+	const SDL_Size firstSize = $(first, sizeThatFits);
+	ck_assert_int_eq(10, firstSize.w);
+	ck_assert_int_eq(10, firstSize.h);
+
+	Array *visible = $(view, visibleSubviews);
+	ck_assert_int_eq(2, visible->count);
+	release(visible);
+
+	release(first);
+	release(view);
+
+}END_TEST
+
+START_TEST(measurements)
+{
+	View *view = $(alloc(View), initWithFrame, NULL);
+	view->autoresizingMask = ViewAutoresizingContain;
+
+	View *subview = $(alloc(View), initWithFrame, &MakeRect(0, 0, 10, 10));
+	$(view, addSubview, subview);
+	release(subview);
+
+	$(view, layoutIfNeeded);
+
+	ck_assert_int_eq(10, view->frame.w);
+	ck_assert_int_eq(10, view->frame.h);
+
+	subview->frame.w = 30;
+
+	$(view, setNeedsLayout);
+	$(view, layoutIfNeeded);
+
+	ck_assert_int_eq(30, view->frame.w);
+	ck_assert_int_eq(10, view->frame.h);
+
+	release(view);
+
+}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("view");
+	tcase_add_test(tcase, relations);
+	tcase_add_test(tcase, priorities);
+	tcase_add_test(tcase, dependencies);
+	tcase_add_test(tcase, resize);
+	tcase_add_test(tcase, removeSubview);
+	tcase_add_test(tcase, visibleSubviews);
+	tcase_add_test(tcase, measurements);
+
+	Suite *suite = suite_create("view");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
@@ -0,0 +1,384 @@
+/*
+ * ObjectivelyMVC: MVC framework for OpenGL and SDL2 in c.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <unistd.h>
+#include <utime.h>
+#include <check.h>
+
+#include <ObjectivelyMVC.h>
+
+#define VIEW_DESCRIPTION_COMPILED "ViewDescription.mvcv"
+#define VIEW_DESCRIPTION_JSON "ViewDescription.json"
+#define VIEW_DESCRIPTION_INCLUDE "ViewDescription.include.json"
+
+/**
+ * @brief Appends `value` to `data` in little-endian byte order.
+ */
+static void appendUInt32(MutableData *data, uint32_t value) {
+
+	const uint8_t bytes[] = {
+		value & 0xff, (value >> 8) & 0xff, (value >> 16) & 0xff, (value >> 24) & 0xff
+	};
+
+	$(data, appendBytes, bytes, sizeof(bytes));
+}
+
+/**
+ * @brief Appends `tag` to `data`.
+ */
+static void appendTag(MutableData *data, ViewDescriptionTag tag) {
+
+	const uint8_t byte = tag;
+
+	$(data, appendBytes, &byte, 1);
+}
+
+/**
+ * @return A new compiled View description header, with a string table of `"class"` and `"View"`,
+ * and an empty number table.
+ */
+static MutableData *header(void) {
+
+	MutableData *data = $$(MutableData, data);
+
+	$(data, appendBytes, (const uint8_t *) VIEW_DESCRIPTION_MAGIC, 4);
+	appendUInt32(data, VIEW_DESCRIPTION_VERSION);
+
+	appendUInt32(data, 2);
+	appendUInt32(data, 5);
+	$(data, appendBytes, (const uint8_t *) "class", 5);
+	appendUInt32(data, 4);
+	$(data, appendBytes, (const uint8_t *) "View", 4);
+
+	appendUInt32(data, 0);
+
+	return data;
+}
+
+/**
+ * @return The decoded View description in `data`.
+ */
+static ident decode(const MutableData *data) {
+	return MVC_DecodeViewDescription(((Data *) data)->bytes, ((Data *) data)->length);
+}
+
+/**
+ * @return A new JSON View description.
+ */
+static ident description(void) {
+
+	const char *json = "{"
+		"\"class\": \"View\","
+		"\"identifier\": \"root\","
+		"\"frame\": [0, 0, 320, 240],"
+		"\"hidden\": false,"
+		"\"subviews\": [{"
+			"\"class\": \"View\","
+			"\"frame\": [0, 0, 320, 24],"
+			"\"backgroundColor\": [0, 0, 0, 255]"
+		"}]"
+	"}";
+
+	Data *data = $$(Data, dataWithBytes, (const uint8_t *) json, strlen(json));
+	ident obj = $$(JSONSerialization, objectFromData, data, 0);
+
+	release(data);
+	return obj;
+}
+
+START_TEST(roundTrip)
+{
+	ident obj = description();
+	ck_assert(obj != NULL);
+
+	Data *compiled = MVC_CompileViewDescription(obj);
+	ck_assert(compiled != NULL);
+	ck_assert(MVC_IsCompiledViewDescription(compiled->bytes, compiled->length));
+
+	Dictionary *root = MVC_DecodeViewDescription(compiled->bytes, compiled->length);
+	ck_assert(root != NULL);
+	ck_assert(instanceof(Dictionary, root));
+
+	const String *identifier = $(root, objectForKeyPath, "identifier");
+	ck_assert_str_eq("root", identifier->chars);
+
+	const Boole *hidden = $(root, objectForKeyPath, "hidden");
+	ck_assert(hidden == $$(Boole, False));
+
+	const Array *frame = $(root, objectForKeyPath, "frame");
+	ck_assert_int_eq(4, frame->count);
+	ck_assert_int_eq(320, ((Number *) $(frame, objectAtIndex, 2))->value);
+
+	const Array *subviews = $(root, objectForKeyPath, "subviews");
+	ck_assert_int_eq(1, subviews->count);
+
+	const Dictionary *subview = $(subviews, firstObject);
+	const Array *subviewFrame = $(subview, objectForKeyPath, "frame");
+	const Array *backgroundColor = $(subview, objectForKeyPath, "backgroundColor");
+
+	ck_assert_ptr_eq($(frame, objectAtIndex, 2), $(subviewFrame, objectAtIndex, 2));
+	ck_assert_ptr_eq($(frame, objectAtIndex, 0), $(backgroundColor, objectAtIndex, 0));
+	ck_assert_ptr_eq($(root, objectForKeyPath, "class"), $(subview, objectForKeyPath, "class"));
+
+	release(root);
+	release(compiled);
+	release(obj);
+
+}END_TEST
+
+START_TEST(truncated)
+{
+	ident obj = description();
+
+	Data *compiled = MVC_CompileViewDescription(obj);
+	ck_assert(compiled != NULL);
+
+	for (size_t length = 0; length < compiled->length; length++) {
+		ck_assert(MVC_DecodeViewDescription(compiled->bytes, length) == NULL);
+	}
+
+	MutableData *trailing = $$(MutableData, data);
+	$(trailing, appendData, compiled);
+	appendTag(trailing, ViewDescriptionTagNull);
+
+	ck_assert(decode(trailing) == NULL);
+
+	release(trailing);
+	release(compiled);
+	release(obj);
+
+}END_TEST
+
+START_TEST(badIndexes)
+{
+	MutableData *data = header();
+	appendTag(data, ViewDescriptionTagDictionary);
+	appendUInt32(data, 1);
+	appendUInt32(data, 0);
+	appendTag(data, ViewDescriptionTagString);
+	appendUInt32(data, 1);
+
+	ident obj = decode(data);
+	ck_assert(obj != NULL);
+	release(obj);
+	release(data);
+
+	data = header();
+	appendTag(data, ViewDescriptionTagString);
+	appendUInt32(data, 2);
+
+	ck_assert(decode(data) == NULL);
+	release(data);
+
+	data = header();
+	appendTag(data, ViewDescriptionTagDictionary);
+	appendUInt32(data, 1);
+	appendUInt32(data, 0xffffffff);
+	appendTag(data, ViewDescriptionTagNull);
+
+	ck_assert(decode(data) == NULL);
+	release(data);
+
+	data = header();
+	appendTag(data, ViewDescriptionTagNumber);
+	appendUInt32(data, 0);
+
+	ck_assert(decode(data) == NULL);
+	release(data);
+
+	data = header();
+	appendTag(data, ViewDescriptionTagNumberArray);
+	appendUInt32(data, 1);
+	appendUInt32(data, 0);
+
+	ck_assert(decode(data) == NULL);
+	release(data);
+
+	data = header();
+	appendTag(data, ViewDescriptionTagArray);
+	appendUInt32(data, 0x7fffffff);
+
+	ck_assert(decode(data) == NULL);
+	release(data);
+
+	data = header();
+	appendTag(data, ViewDescriptionTagDictionary + 1);
+
+	ck_assert(decode(data) == NULL);
+	release(data);
+
+}END_TEST
+
+START_TEST(depth)
+{
+	MutableData *data = header();
+
+	for (int i = 0; i < VIEW_DESCRIPTION_MAX_DEPTH; i++) {
+		appendTag(data, ViewDescriptionTagArray);
+		appendUInt32(data, 1);
+	}
+
+	appendTag(data, ViewDescriptionTagNull);
+
+	ident obj = decode(data);
+	ck_assert(obj != NULL);
+	release(obj);
+	release(data);
+
+	data = header();
+
+	for (int i = 0; i < VIEW_DESCRIPTION_MAX_DEPTH + 1; i++) {
+		appendTag(data, ViewDescriptionTagArray);
+		appendUInt32(data, 1);
+	}
+
+	appendTag(data, ViewDescriptionTagNull);
+
+	ck_assert(decode(data) == NULL);
+	release(data);
+
+}END_TEST
+
+START_TEST(readViewDescription)
+{
+	ident obj = description();
+
+	Data *compiled = MVC_CompileViewDescription(obj);
+	ck_assert($(compiled, writeToFile, VIEW_DESCRIPTION_COMPILED));
+
+	Dictionary *dictionary = MVC_ReadViewDescription(VIEW_DESCRIPTION_COMPILED);
+	ck_assert(dictionary != NULL);
+	ck_assert_str_eq("root", ((String *) $(dictionary, objectForKeyPath, "identifier"))->chars);
+	release(dictionary);
+
+	const char *json = "{\"class\": \"View\", \"identifier\": \"json\"}";
+
+	Data *data = $$(Data, dataWithBytes, (const uint8_t *) json, strlen(json));
+	ck_assert($(data, writeToFile, VIEW_DESCRIPTION_JSON));
+
+	dictionary = MVC_ReadViewDescription(VIEW_DESCRIPTION_JSON);
+	ck_assert(dictionary != NULL);
+	ck_assert_str_eq("json", ((String *) $(dictionary, objectForKeyPath, "identifier"))->chars);
+	release(dictionary);
+
+	ck_assert(MVC_ReadViewDescription("ViewDescription.missing") == NULL);
+
+	unlink(VIEW_DESCRIPTION_COMPILED);
+	unlink(VIEW_DESCRIPTION_JSON);
+
+	release(data);
+	release(compiled);
+	release(obj);
+
+}END_TEST
+
+/**
+ * @brief Writes a JSON View description with the given identifier and modification time.
+ */
+static void writeInclude(const char *identifier, time_t modificationTime) {
+
+	char json[128];
+	snprintf(json, sizeof(json), "{\"class\": \"View\", \"identifier\": \"%s\"}", identifier);
+
+	Data *data = $$(Data, dataWithBytes, (const uint8_t *) json, strlen(json));
+	ck_assert($(data, writeToFile, VIEW_DESCRIPTION_INCLUDE));
+	release(data);
+
+	const struct utimbuf times = { modificationTime, modificationTime };
+	ck_assert_int_eq(0, utime(VIEW_DESCRIPTION_INCLUDE, &times));
+}
+
+START_TEST(includeCache)
+{
+	writeInclude("a", 1000);
+
+	Dictionary *a = MVC_IncludeViewDescription(VIEW_DESCRIPTION_INCLUDE);
+	ck_assert(a != NULL);
+	ck_assert_str_eq("a", ((String *) $(a, objectForKeyPath, "identifier"))->chars);
+
+	ck_assert_ptr_eq(a, MVC_IncludeViewDescription(VIEW_DESCRIPTION_INCLUDE));
+	ck_assert_ptr_eq(a, MVC_IncludeViewDescription("./" VIEW_DESCRIPTION_INCLUDE));
+
+	retain(a);
+
+	writeInclude("b", 2000);
+
+	ck_assert_ptr_eq(a, MVC_IncludeViewDescription(VIEW_DESCRIPTION_INCLUDE));
+
+	MVC_SetIncludeCacheValidation(true);
+
+	Dictionary *b = MVC_IncludeViewDescription(VIEW_DESCRIPTION_INCLUDE);
+	ck_assert(b != NULL);
+	ck_assert(b != a);
+	ck_assert_str_eq("b", ((String *) $(b, objectForKeyPath, "identifier"))->chars);
+
+	ck_assert_ptr_eq(b, MVC_IncludeViewDescription(VIEW_DESCRIPTION_INCLUDE));
+	ck_assert_ptr_eq(b, MVC_IncludeViewDescription("./" VIEW_DESCRIPTION_INCLUDE));
+
+	MVC_SetIncludeCacheValidation(false);
+
+	retain(b);
+
+	MVC_ClearIncludeCache();
+
+	writeInclude("c", 2000);
+
+	Dictionary *c = MVC_IncludeViewDescription(VIEW_DESCRIPTION_INCLUDE);
+	ck_assert(c != NULL);
+	ck_assert(c != b);
+	ck_assert_str_eq("c", ((String *) $(c, objectForKeyPath, "identifier"))->chars);
+
+	unlink(VIEW_DESCRIPTION_INCLUDE);
+
+	ck_assert(MVC_IncludeViewDescription("ViewDescription.missing") == NULL);
+
+	MVC_ClearIncludeCache();
+	MVC_ClearIncludeCache();
+
+	release(a);
+	release(b);
+
+}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("viewDescription");
+	tcase_add_test(tcase, roundTrip);
+	tcase_add_test(tcase, truncated);
+	tcase_add_test(tcase, badIndexes);
+	tcase_add_test(tcase, depth);
+	tcase_add_test(tcase, readViewDescription);
+	tcase_add_test(tcase, includeCache);
+
+	Suite *suite = suite_create("viewDescription");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
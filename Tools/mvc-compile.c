@@ -0,0 +1,71 @@
+/*
+ * ObjectivelyMVC: MVC framework for OpenGL and SDL2 in c.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <stdio.h>
+
+#include <Objectively.h>
+#include <ObjectivelyMVC.h>
+
+/**
+ * @brief Compiles a JSON View description for View::viewWithContentsOfFile.
+ * @details Usage: `mvc-compile input.json output`
+ */
+int main(int argc, char *argv[]) {
+
+	if (argc != 3) {
+		fprintf(stderr, "Usage: %s input.json output\n", argv[0]);
+		return 1;
+	}
+
+	Data *data = $$(Data, dataWithContentsOfFile, argv[1]);
+	if (data == NULL) {
+		fprintf(stderr, "%s: Failed to read %s\n", argv[0], argv[1]);
+		return 1;
+	}
+
+	ident obj = $$(JSONSerialization, objectFromData, data, 0);
+	release(data);
+
+	if (obj == NULL) {
+		fprintf(stderr, "%s: Failed to parse %s\n", argv[0], argv[1]);
+		return 1;
+	}
+
+	Data *compiled = MVC_CompileViewDescription(obj);
+	release(obj);
+
+	if (compiled == NULL) {
+		fprintf(stderr, "%s: Failed to compile %s\n", argv[0], argv[1]);
+		return 1;
+	}
+
+	const _Bool written = $(compiled, writeToFile, argv[2]);
+	release(compiled);
+
+	if (written == false) {
+		fprintf(stderr, "%s: Failed to write %s\n", argv[0], argv[2]);
+		return 1;
+	}
+
+	return 0;
+}